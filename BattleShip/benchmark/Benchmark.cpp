@@ -0,0 +1,206 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Implementation file for the Benchmark class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+
+using namespace std;
+
+/**
+ * @brief Finds the value of a key in a line written by writeJson().
+ *
+ * @param line The line to search.
+ * @param key The key without quotes.
+ * @return The text of the value without quotes, empty if the key is
+ *         missing.
+ */
+static string jsonValue(const string& line, const string& key) {
+    string quoted = "\"" + key + "\": ";
+    size_t start = line.find(quoted);
+    if (start == string::npos) {
+        return "";
+    }
+    start += quoted.size();
+    if (start < line.size() && line[start] == '"') {
+        size_t end = line.find('"', start + 1);
+        return line.substr(start + 1, end - start - 1);
+    }
+    size_t end = line.find_first_of(",}", start);
+    return line.substr(start, end - start);
+}
+
+/**
+ * @brief Constructor to create an empty list of benchmarks.
+ */
+Benchmark::Benchmark() : warmup{DEFAULT_WARMUP},
+        repetitions{DEFAULT_REPETITIONS} {
+}
+
+/**
+ * @brief Registers a benchmark without setup.
+ *
+ * @param name The name in the results.
+ * @param body Performs one repetition and returns its operations.
+ */
+void Benchmark::add(const std::string& name, const Body& body) {
+    cases.push_back(Case{name, Setup{}, body});
+}
+
+/**
+ * @brief Registers a benchmark with an untimed setup.
+ *
+ * @param name The name in the results.
+ * @param setup Prepares the data of one repetition.
+ * @param body Performs one repetition and returns its operations.
+ */
+void Benchmark::add(const std::string& name, const Setup& setup,
+        const Body& body) {
+    cases.push_back(Case{name, setup, body});
+}
+
+/**
+ * @brief Sets the number of untimed repetitions.
+ *
+ * @param warmup Number of repetitions, at least 0.
+ */
+void Benchmark::setWarmup(int warmup) {
+    this->warmup = max(0, warmup);
+}
+
+/**
+ * @brief Sets the number of timed repetitions.
+ *
+ * @param repetitions Number of repetitions, at least 1.
+ */
+void Benchmark::setRepetitions(int repetitions) {
+    this->repetitions = max(1, repetitions);
+}
+
+/**
+ * @brief Runs only the benchmarks whose name contains a text.
+ *
+ * @param filter The text; empty runs all benchmarks.
+ */
+void Benchmark::setFilter(const std::string& filter) {
+    this->filter = filter;
+}
+
+/**
+ * @brief Runs the benchmarks.
+ *
+ * @details The setup of a repetition runs just before its body, so the
+ *          body sees warm caches for its input but no leftovers of the
+ *          previous repetition.
+ *
+ * @param log Receives one line per benchmark while running.
+ * @return The timing of every benchmark that was run.
+ */
+vector<BenchmarkStats> Benchmark::run(std::ostream& log) const {
+    vector<BenchmarkStats> results;
+    for (const Case& benchmark : cases) {
+        if (benchmark.name.find(filter) == string::npos) {
+            continue;
+        }
+        for (int round = 0; round < warmup; round++) {
+            if (benchmark.setup) {
+                benchmark.setup();
+            }
+            benchmark.body();
+        }
+
+        BenchmarkStats stats;
+        stats.name = benchmark.name;
+        stats.repetitions = repetitions;
+        vector<double> times;
+        for (int round = 0; round < repetitions; round++) {
+            if (benchmark.setup) {
+                benchmark.setup();
+            }
+            auto start = chrono::steady_clock::now();
+            long operations = benchmark.body();
+            auto stop = chrono::steady_clock::now();
+            stats.operations = max(1L, operations);
+            times.push_back(chrono::duration<double, nano>(stop - start)
+                    .count() / stats.operations);
+        }
+
+        sort(times.begin(), times.end());
+        size_t middle = times.size() / 2;
+        stats.minNs = times.front();
+        stats.medianNs = times.size() % 2 == 1 ? times[middle]
+                : (times[middle - 1] + times[middle]) / 2;
+        for (double time : times) {
+            stats.meanNs += time / times.size();
+        }
+        double squares = 0;
+        for (double time : times) {
+            squares += (time - stats.meanNs) * (time - stats.meanNs);
+        }
+        stats.stddevNs = times.size() > 1
+                ? sqrt(squares / (times.size() - 1)) : 0;
+        results.push_back(stats);
+
+        log << left << setw(32) << stats.name << right << fixed
+                << setprecision(1) << setw(12) << stats.medianNs
+                << " ns/op  (min " << stats.minNs << ", +/- "
+                << stats.stddevNs << ")" << setprecision(0) << setw(14)
+                << 1e9 / stats.medianNs << " ops/s" << endl;
+    }
+    return results;
+}
+
+/**
+ * @brief Writes results as JSON, one benchmark per line.
+ *
+ * @param out The stream to write to.
+ * @param results The results of run().
+ */
+void Benchmark::writeJson(std::ostream& out,
+        const std::vector<BenchmarkStats>& results) {
+    out << "{\"benchmarks\": [" << endl;
+    out << setprecision(3) << fixed;
+    for (size_t index = 0; index < results.size(); index++) {
+        const BenchmarkStats& stats = results[index];
+        out << "  {\"name\": \"" << stats.name << "\", \"operations\": "
+                << stats.operations << ", \"repetitions\": "
+                << stats.repetitions << ", \"min_ns\": " << stats.minNs
+                << ", \"median_ns\": " << stats.medianNs << ", \"mean_ns\": "
+                << stats.meanNs << ", \"stddev_ns\": " << stats.stddevNs
+                << "}" << (index + 1 < results.size() ? "," : "") << endl;
+    }
+    out << "]}" << endl;
+}
+
+/**
+ * @brief Reads the median times of a file written by writeJson().
+ *
+ * @details Only the layout of writeJson() is understood: one benchmark
+ *          object per line.
+ *
+ * @param in The stream to read from.
+ * @return The median ns per operation of every benchmark in the file.
+ */
+map<string, double> Benchmark::readBaseline(std::istream& in) {
+    map<string, double> medians;
+    string line;
+    while (getline(in, line)) {
+        string name = jsonValue(line, "name");
+        string median = jsonValue(line, "median_ns");
+        if (name.empty() == false && median.empty() == false) {
+            medians[name] = strtod(median.c_str(), nullptr);
+        }
+    }
+    return medians;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file Benchmark.h
+ * @brief Header file for the Benchmark class, a small harness that times
+ *        the hot paths of the game and reports the results as a table and
+ *        as JSON.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Keeps the compiler from removing a computation whose result is
+ *        not used otherwise.
+ *
+ * @param value The result of the computation.
+ */
+template <class T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* volatile sink
+            = reinterpret_cast<const volatile char*>(&value);
+    (void)sink;
+#endif
+}
+
+/**
+ * @struct BenchmarkStats
+ * @brief Timing of one benchmark, per operation.
+ */
+struct BenchmarkStats {
+    std::string name;    ///< Name of the benchmark.
+    long operations = 0; ///< Operations per repetition.
+    int repetitions = 0; ///< Timed repetitions.
+    double minNs = 0;    ///< Fastest repetition, in ns per operation.
+    double medianNs = 0; ///< Median repetition, in ns per operation.
+    double meanNs = 0;   ///< Mean of the repetitions, in ns per operation.
+    double stddevNs = 0; ///< Standard deviation of the repetitions.
+};
+
+/**
+ * @class Benchmark
+ * @brief Runs a list of benchmarks with warm-up and repetitions.
+ *
+ * @details A benchmark is a body that performs a batch of operations and
+ *          returns their number, and an optional setup that prepares the
+ *          data for one batch outside the timed region. Every benchmark is
+ *          run getWarmup() times untimed and then getRepetitions() times
+ *          timed with a steady clock.
+ */
+class Benchmark {
+public:
+    /// Prepares the data of one repetition; not timed.
+    using Setup = std::function<void()>;
+    /// Performs one repetition and returns the number of operations.
+    using Body = std::function<long()>;
+
+    static constexpr int DEFAULT_WARMUP = 3;       ///< Untimed repetitions.
+    static constexpr int DEFAULT_REPETITIONS = 15; ///< Timed repetitions.
+
+private:
+    /**
+     * @struct Case
+     * @brief One registered benchmark.
+     */
+    struct Case {
+        std::string name; ///< Name in the results.
+        Setup setup;      ///< Prepares a repetition, may be empty.
+        Body body;        ///< The timed work.
+    };
+
+    std::vector<Case> cases; ///< Registered benchmarks, in order.
+    int warmup;              ///< Untimed repetitions.
+    int repetitions;         ///< Timed repetitions.
+    std::string filter;      ///< Only names containing it are run.
+
+public:
+    /**
+     * @brief Constructor to create an empty list of benchmarks.
+     */
+    Benchmark();
+
+    /**
+     * @brief Registers a benchmark without setup.
+     *
+     * @param name The name in the results.
+     * @param body Performs one repetition and returns its operations.
+     */
+    void add(const std::string& name, const Body& body);
+
+    /**
+     * @brief Registers a benchmark with an untimed setup.
+     *
+     * @param name The name in the results.
+     * @param setup Prepares the data of one repetition.
+     * @param body Performs one repetition and returns its operations.
+     */
+    void add(const std::string& name, const Setup& setup, const Body& body);
+
+    /**
+     * @brief Sets the number of untimed repetitions.
+     *
+     * @param warmup Number of repetitions, at least 0.
+     */
+    void setWarmup(int warmup);
+
+    /**
+     * @brief Sets the number of timed repetitions.
+     *
+     * @param repetitions Number of repetitions, at least 1.
+     */
+    void setRepetitions(int repetitions);
+
+    /**
+     * @brief Runs only the benchmarks whose name contains a text.
+     *
+     * @param filter The text; empty runs all benchmarks.
+     */
+    void setFilter(const std::string& filter);
+
+    /**
+     * @brief Runs the benchmarks.
+     *
+     * @param log Receives one line per benchmark while running.
+     * @return The timing of every benchmark that was run.
+     */
+    std::vector<BenchmarkStats> run(std::ostream& log) const;
+
+    /**
+     * @brief Writes results as JSON, one benchmark per line.
+     *
+     * @param out The stream to write to.
+     * @param results The results of run().
+     */
+    static void writeJson(std::ostream& out,
+            const std::vector<BenchmarkStats>& results);
+
+    /**
+     * @brief Reads the median times of a file written by writeJson().
+     *
+     * @param in The stream to read from.
+     * @return The median ns per operation of every benchmark in the file.
+     */
+    static std::map<std::string, double> readBaseline(std::istream& in);
+};
+
+#endif /* BENCHMARK_H_ */
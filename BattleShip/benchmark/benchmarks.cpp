@@ -0,0 +1,444 @@
+/**
+ * @file benchmarks.cpp
+ * @brief Entry point of the benchmark executable.
+ *
+ * @details Times the hot paths of the game: the area computations of Ship,
+ *          placing ships and taking shots in OwnGrid, recording results in
+ *          OpponentGrid, printing the board, parsing grid positions,
+ *          complete games and replay files. Usage:
+ *
+ *          Benchmark [--filter TEXT] [--repetitions N] [--warmup N]
+ *                    [--json FILE] [--baseline FILE]
+ *
+ *          --json writes the results for a later --baseline run, which
+ *          prints the ratio of every median to the stored one.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.h"
+#include "Board.h"
+#include "BoardCheckpoint.h"
+#include "ConsoleView.h"
+#include "EndgameSolver.h"
+#include "FleetGenerator.h"
+#include "GridPosition.h"
+#include "HeatMap.h"
+#include "HeatMapStrategy.h"
+#include "HuntTargetStrategy.h"
+#include "MatchEngine.h"
+#include "OpponentGrid.h"
+#include "OwnGrid.h"
+#include "Random.h"
+#include "ReplayReader.h"
+#include "ReplayWriter.h"
+#include "Ship.h"
+#include "Shot.h"
+
+using namespace std;
+
+static constexpr int GRIDS_PER_REPETITION = 100; ///< Grids per repetition.
+static constexpr int LOOPS_PER_REPETITION = 1000; ///< Loops over the fleet.
+static constexpr int PRINTS_PER_REPETITION = 200; ///< Boards printed.
+static constexpr int GAMES_PER_REPETITION = 200;  ///< Games played.
+
+/**
+ * @brief Registers all benchmarks.
+ *
+ * @param benchmark Receives the benchmarks.
+ * @param fleet A grid with a complete standard fleet.
+ */
+static void addBenchmarks(Benchmark& benchmark, const OwnGrid& fleet) {
+    const vector<Ship>& ships = fleet.getShips();
+    int rows = STANDARD_RULES.getRows();
+    int columns = STANDARD_RULES.getColumns();
+    int cells = STANDARD_RULES.getCells();
+
+    benchmark.add("Ship::occupiedArea", [&ships]() {
+        for (int loop = 0; loop < LOOPS_PER_REPETITION; loop++) {
+            for (const Ship& ship : ships) {
+                doNotOptimize(ship.occupiedArea());
+            }
+        }
+        return long(LOOPS_PER_REPETITION) * long(ships.size());
+    });
+    benchmark.add("Ship::blockedArea", [&ships]() {
+        for (int loop = 0; loop < LOOPS_PER_REPETITION; loop++) {
+            for (const Ship& ship : ships) {
+                doNotOptimize(ship.blockedArea(STANDARD_RULES));
+            }
+        }
+        return long(LOOPS_PER_REPETITION) * long(ships.size());
+    });
+    benchmark.add("Ship::blockedMask", [&ships]() {
+        for (int loop = 0; loop < LOOPS_PER_REPETITION; loop++) {
+            for (const Ship& ship : ships) {
+                doNotOptimize(ship.blockedMask(STANDARD_RULES));
+            }
+        }
+        return long(LOOPS_PER_REPETITION) * long(ships.size());
+    });
+
+    // Every repetition starts from fresh grids, prepared outside the timing
+    auto grids = make_shared<vector<OwnGrid>>();
+    benchmark.add("OwnGrid::placeShip", [grids]() {
+        grids->assign(GRIDS_PER_REPETITION, OwnGrid{STANDARD_RULES});
+    }, [grids, &ships]() {
+        for (OwnGrid& grid : *grids) {
+            for (const Ship& ship : ships) {
+                doNotOptimize(grid.placeShip(ship));
+            }
+        }
+        return long(GRIDS_PER_REPETITION) * long(ships.size());
+    });
+    benchmark.add("OwnGrid::takeBlow", [grids, &fleet]() {
+        grids->assign(GRIDS_PER_REPETITION, fleet);
+    }, [grids, rows, columns]() {
+        for (OwnGrid& grid : *grids) {
+            for (int row = 0; row < rows; row++) {
+                for (int column = 1; column <= columns; column++) {
+                    Shot shot{GridPosition{char('A' + row), column}};
+                    doNotOptimize(grid.takeBlow(shot));
+                }
+            }
+        }
+        return long(GRIDS_PER_REPETITION) * rows * columns;
+    });
+
+    // The results of shooting at every cell of the fleet, in order
+    vector<pair<CellIndex, Shot::Impact>> results;
+    OwnGrid target = fleet;
+    for (int cell = 0; cell < cells; cell++) {
+        CellIndex index{static_cast<uint16_t>(cell)};
+        results.emplace_back(index, target.takeBlow(index));
+    }
+    auto opponents = make_shared<vector<OpponentGrid>>();
+    benchmark.add("OpponentGrid::shotResult", [opponents]() {
+        opponents->assign(GRIDS_PER_REPETITION, OpponentGrid{STANDARD_RULES});
+    }, [opponents, results, columns]() {
+        for (OpponentGrid& grid : *opponents) {
+            for (const auto& result : results) {
+                grid.shotResult(Shot{result.first.toPosition(columns)},
+                        result.second);
+            }
+            doNotOptimize(grid.getHitMask());
+        }
+        return long(GRIDS_PER_REPETITION) * long(results.size());
+    });
+
+    // Half of the cells shot at, printed into a string
+    auto board = make_shared<Board>(STANDARD_RULES);
+    for (const Ship& ship : ships) {
+        board->getOwnGrid().placeShip(ship);
+    }
+    for (int cell = 0; cell < cells; cell += 2) {
+        board->getOwnGrid().takeBlow(results[cell].first);
+        board->getOpponentGrid().shotResult(results[cell].first,
+                results[cell].second);
+    }
+    auto printed = make_shared<ostringstream>();
+    benchmark.add("ConsoleView::print", [printed]() {
+        printed->str("");
+    }, [board, printed]() {
+        ConsoleView view{board.get()};
+        streambuf* console = cout.rdbuf(printed->rdbuf());
+        for (int print = 0; print < PRINTS_PER_REPETITION; print++) {
+            view.print();
+        }
+        cout.rdbuf(console);
+        return long(PRINTS_PER_REPETITION);
+    });
+
+    // Restoring the same board from a checkpoint and by replaying its moves
+    auto checkpoint = make_shared<BoardCheckpoint>(*board);
+    auto restored = make_shared<Board>(STANDARD_RULES);
+    benchmark.add("BoardCheckpoint::restore", [checkpoint, restored]() {
+        for (int grid = 0; grid < GRIDS_PER_REPETITION; grid++) {
+            doNotOptimize(checkpoint->restore(*restored));
+        }
+        return long(GRIDS_PER_REPETITION);
+    });
+    benchmark.add("Board replay (placeShip/takeBlow)",
+            [ships, results, cells, restored]() {
+        for (int grid = 0; grid < GRIDS_PER_REPETITION; grid++) {
+            restored->getOwnGrid().reset();
+            restored->getOpponentGrid().reset();
+            for (const Ship& ship : ships) {
+                restored->getOwnGrid().placeShip(ship);
+            }
+            for (int cell = 0; cell < cells; cell += 2) {
+                restored->getOwnGrid().takeBlow(results[cell].first);
+                restored->getOpponentGrid().shotResult(results[cell].first,
+                        results[cell].second);
+            }
+            doNotOptimize(restored->getOwnGrid().getShotMask());
+        }
+        return long(GRIDS_PER_REPETITION);
+    });
+
+    // Heat maps of the states of one game, computed and from a cache that
+    // already holds them
+    auto states = make_shared<vector<OpponentGrid>>();
+    OpponentGrid state{STANDARD_RULES};
+    for (int cell = 0; cell < cells; cell += 2) {
+        state.shotResult(results[cell].first, results[cell].second);
+        states->push_back(state);
+    }
+    auto heat = make_shared<HeatMap>(STANDARD_RULES);
+    auto heatCache = make_shared<HeatMap::Cache>(4096);
+    benchmark.add("HeatMap::compute", [states, heat]() {
+        for (const OpponentGrid& grid : *states) {
+            heat->compute(grid);
+            doNotOptimize(heat->getCounts());
+        }
+        return long(states->size());
+    });
+    benchmark.add("HeatMap::compute (cached)", [states, heat, heatCache]() {
+        for (const OpponentGrid& grid : *states) {
+            heat->compute(grid, *heatCache);
+            doNotOptimize(heat->getCounts());
+        }
+        return long(states->size());
+    });
+
+    // Late positions of heat map games, solved without a warm memo
+    auto endgames = make_shared<vector<OpponentGrid>>();
+    auto solver = make_shared<EndgameSolver>();
+    Random endgameRandom{5};
+    HeatMapStrategy endgameHeat{endgameRandom};
+    FleetGenerator endgameFleets;
+    for (int game = 0; game < 16; game++) {
+        OwnGrid fleet{STANDARD_RULES};
+        OpponentGrid endgame{STANDARD_RULES};
+        endgameFleets.fill(fleet, endgameRandom);
+        while (solver->uncertainty(endgame) > solver->getThreshold()) {
+            CellIndex target = endgameHeat.nextShot(endgame);
+            endgame.shotResult(target, fleet.takeBlow(target));
+        }
+        endgames->push_back(endgame);
+    }
+    auto endgamePool = make_shared<ThreadPool>();
+    benchmark.add("EndgameSolver::solve", [endgames, solver]() {
+        for (const OpponentGrid& grid : *endgames) {
+            solver->clearMemo();
+            doNotOptimize(solver->solve(grid));
+        }
+        return long(endgames->size());
+    });
+    benchmark.add("EndgameSolver::solve (pool)",
+            [endgames, solver, endgamePool]() {
+        for (const OpponentGrid& grid : *endgames) {
+            solver->clearMemo();
+            doNotOptimize(solver->solve(grid, *endgamePool));
+        }
+        return long(endgames->size());
+    });
+
+    vector<string> positions;
+    for (int row = 0; row < rows; row++) {
+        for (int column = 1; column <= columns; column++) {
+            positions.push_back(char('A' + row) + to_string(column));
+        }
+    }
+    benchmark.add("GridPosition(string)", [positions]() {
+        for (int loop = 0; loop < LOOPS_PER_REPETITION / 10; loop++) {
+            for (const string& position : positions) {
+                doNotOptimize(GridPosition{position});
+            }
+        }
+        return long(LOOPS_PER_REPETITION / 10) * long(positions.size());
+    });
+
+    // The generator against xoshiro256** written out by hand
+    static constexpr int DRAWS_PER_REPETITION = 100000;
+    benchmark.add("Random::next", []() {
+        Random random = Random::stream(2026, 0, Random::SAMPLING);
+        uint64_t sum = 0;
+        for (int draw = 0; draw < DRAWS_PER_REPETITION; draw++) {
+            sum += random.next();
+        }
+        doNotOptimize(sum);
+        return long(DRAWS_PER_REPETITION);
+    });
+    benchmark.add("xoshiro256** (hand-inlined)", []() {
+        uint64_t s0 = 1;
+        uint64_t s1 = 2;
+        uint64_t s2 = 3;
+        uint64_t s3 = 4;
+        uint64_t sum = 0;
+        for (int draw = 0; draw < DRAWS_PER_REPETITION; draw++) {
+            uint64_t product = s1 * 5;
+            sum += ((product << 7) | (product >> 57)) * 9;
+            uint64_t shifted = s1 << 17;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= shifted;
+            s3 = (s3 << 45) | (s3 >> 19);
+        }
+        doNotOptimize(sum);
+        return long(DRAWS_PER_REPETITION);
+    });
+    benchmark.add("Random::stream", []() {
+        uint64_t sum = 0;
+        for (int game = 0; game < DRAWS_PER_REPETITION / 10; game++) {
+            sum += Random::stream(2026, game, Random::FIRST_PLAYER).next();
+        }
+        doNotOptimize(sum);
+        return long(DRAWS_PER_REPETITION / 10);
+    });
+
+    // Standard fleets of the default policy, as drawn for every game
+    static constexpr int FLEETS_PER_REPETITION = 1000;
+    auto generator = make_shared<FleetGenerator>();
+    benchmark.add("FleetGenerator::generate (default)", [generator]() {
+        Random random = Random::stream(2026, 0, Random::FIRST_PLAYER);
+        FleetGenerator::Layout layout;
+        long placed = 0;
+        for (int fleet = 0; fleet < FLEETS_PER_REPETITION; fleet++) {
+            placed += generator->generate(random, layout);
+        }
+        doNotOptimize(placed);
+        return long(FLEETS_PER_REPETITION);
+    });
+
+    benchmark.add("MatchEngine::play (hunt/target)", []() {
+        MatchEngine engine;
+        Random firstRandom{1};
+        Random secondRandom{2};
+        HuntTargetStrategy first{firstRandom};
+        HuntTargetStrategy second{secondRandom};
+        for (int game = 0; game < GAMES_PER_REPETITION; game++) {
+            doNotOptimize(engine.play(first, second));
+        }
+        return long(GAMES_PER_REPETITION);
+    });
+
+    // Replays of hunt/target games
+    auto games = make_shared<vector<GameRecord>>(GAMES_PER_REPETITION);
+    auto replay = make_shared<string>(ReplayWriter::MAGIC);
+    MatchEngine engine;
+    Random firstRandom{3};
+    Random secondRandom{4};
+    HuntTargetStrategy first{firstRandom};
+    HuntTargetStrategy second{secondRandom};
+    auto writer = make_shared<ReplayWriter>();
+    for (GameRecord& game : *games) {
+        engine.setRecord(&game);
+        engine.play(first, second);
+        writer->encode(game, *replay);
+    }
+    cout << "Replay: " << double(replay->size()) / games->size()
+            << " bytes per game" << endl;
+    auto bytes = make_shared<string>();
+    benchmark.add("ReplayWriter::encode", [bytes]() {
+        bytes->clear();
+    }, [games, writer, bytes]() {
+        for (const GameRecord& game : *games) {
+            writer->encode(game, *bytes);
+        }
+        doNotOptimize(bytes->size());
+        return long(games->size());
+    });
+    // The reader refers to the bytes, so the benchmark keeps them alive
+    auto reader = make_shared<ReplayReader>();
+    reader->parse(*replay);
+    benchmark.add("ReplayReader::stateAt", [reader, replay, games]() {
+        ReplayState state;
+        for (size_t game = 0; game < games->size(); game++) {
+            int moves = static_cast<int>((*games)[game].moves.size());
+            reader->stateAt(game, moves - 1, state);
+            doNotOptimize(state);
+        }
+        return long(games->size());
+    });
+}
+
+/**
+ * @brief Entry point of the benchmark executable.
+ *
+ * @param argc Number of arguments.
+ * @param argv The arguments; see the file description.
+ * @return 0 on success, 1 on bad arguments or unreadable files.
+ */
+int main(int argc, char* argv[]) {
+    Benchmark benchmark;
+    string jsonFile;
+    string baselineFile;
+    for (int index = 1; index < argc; index++) {
+        string option = argv[index];
+        if (index + 1 >= argc) {
+            cerr << "Missing value for " << option << endl;
+            return 1;
+        }
+        string value = argv[++index];
+        if (option == "--filter") {
+            benchmark.setFilter(value);
+        } else if (option == "--repetitions") {
+            benchmark.setRepetitions(atoi(value.c_str()));
+        } else if (option == "--warmup") {
+            benchmark.setWarmup(atoi(value.c_str()));
+        } else if (option == "--json") {
+            jsonFile = value;
+        } else if (option == "--baseline") {
+            baselineFile = value;
+        } else {
+            cerr << "Unknown option " << option << endl;
+            return 1;
+        }
+    }
+
+    OwnGrid fleet{STANDARD_RULES};
+    FleetGenerator generator{STANDARD_RULES, FleetGenerator::AVOID_EDGES};
+    Random random{2026};
+    if (generator.fill(fleet, random) == false) {
+        cerr << "Could not place the benchmark fleet" << endl;
+        return 1;
+    }
+    addBenchmarks(benchmark, fleet);
+    vector<BenchmarkStats> results = benchmark.run(cout);
+
+    if (jsonFile.empty() == false) {
+        ofstream out{jsonFile};
+        if (!out) {
+            cerr << "Cannot write " << jsonFile << endl;
+            return 1;
+        }
+        Benchmark::writeJson(out, results);
+    }
+    if (baselineFile.empty() == false) {
+        ifstream in{baselineFile};
+        if (!in) {
+            cerr << "Cannot read " << baselineFile << endl;
+            return 1;
+        }
+        map<string, double> baseline = Benchmark::readBaseline(in);
+        cout << endl << "Median compared with " << baselineFile
+                << " (below 1 is faster):" << endl;
+        for (const BenchmarkStats& stats : results) {
+            auto stored = baseline.find(stats.name);
+            if (stored == baseline.end() || stored->second <= 0) {
+                continue;
+            }
+            cout << left << setw(32) << stats.name << right << fixed
+                    << setprecision(2) << setw(8)
+                    << stats.medianNs / stored->second << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+/**
+ * @file Bitboard.cpp
+ * @brief Implementation file for the non-constexpr parts of the Bitboard
+ *        class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "Bitboard.h"
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Converts the set to grid positions.
+ *
+ * @param columns The number of columns of the grid.
+ * @return The positions of all cells in the set.
+ */
+set<GridPosition> Bitboard::toPositions(int columns) const {
+    set<GridPosition> positions;
+    Bitboard remaining = *this;
+    for (int index = remaining.popFirst(); index >= 0;
+            index = remaining.popFirst()) {
+        positions.insert(CellIndex(uint16_t(index)).toPosition(columns));
+    }
+    return positions;
+}
+
+/**
+ * @brief Overloads the << operator to print the cells of a set.
+ *
+ * @param lhs Output stream to which the set is written.
+ * @param rhs The set to output.
+ * @return Reference to the output stream.
+ */
+ostream& operator<<(ostream& lhs, const Bitboard& rhs) {
+    for (int index = 0; index < Bitboard::CAPACITY; index++) {
+        lhs << (rhs.test(index) ? '1' : '0');
+    }
+    return lhs;
+}
@@ -0,0 +1,375 @@
+/**
+ * @file Bitboard.h
+ * @brief Header file for the Bitboard class, a 128 bit set of grid cells.
+ *
+ * @details Each bit stands for one cell, numbered like CellIndex (row-major,
+ *          zero based). 128 bits cover grids of up to 128 cells, which
+ *          includes the standard 10x10 board. Set operations such as overlap
+ *          and touching checks become a few AND/OR instructions instead of
+ *          building and intersecting std::set objects. All operations are
+ *          constexpr so placement tables can be generated at compile time.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef BITBOARD_H_
+#define BITBOARD_H_
+
+#include "CellIndex.h"
+#include <cstdint>
+#include <iosfwd>
+#include <set>
+
+/**
+ * @class Bitboard
+ * @brief Set of up to 128 grid cells stored as two 64 bit words.
+ *
+ * @details Bit n of the board is bit n of the low word for n < 64 and bit
+ *          n - 64 of the high word otherwise.
+ */
+class Bitboard {
+public:
+    static constexpr int CAPACITY = 128; ///< Maximum number of cells.
+
+private:
+    std::uint64_t low;  ///< Cells 0 to 63.
+    std::uint64_t high; ///< Cells 64 to 127.
+
+    /**
+     * @brief Counts the set bits of one word.
+     * @param word The word to count.
+     * @return The number of set bits.
+     */
+    static constexpr int popCount(std::uint64_t word) {
+#if defined(__GNUC__)
+        return __builtin_popcountll(word);
+#else
+        int count = 0;
+        for (; word != 0; word &= word - 1) {
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Finds the lowest set bit of a non-zero word.
+     * @param word The word to search; must not be zero.
+     * @return The position of the lowest set bit.
+     */
+    static constexpr int lowestBit(std::uint64_t word) {
+#if defined(__GNUC__)
+        return __builtin_ctzll(word);
+#else
+        int position = 0;
+        for (; (word & 1) == 0; word >>= 1) {
+            position++;
+        }
+        return position;
+#endif
+    }
+
+public:
+    /**
+     * @brief Constructor to create an empty set.
+     */
+    constexpr Bitboard() : low{0}, high{0} {}
+
+    /**
+     * @brief Constructor to create a set from its two raw words.
+     * @param low Bits of cells 0 to 63.
+     * @param high Bits of cells 64 to 127.
+     */
+    constexpr Bitboard(std::uint64_t low, std::uint64_t high)
+        : low{low}, high{high} {}
+
+    /**
+     * @brief Creates a set containing a single cell.
+     * @param index Linear index of the cell (0 to 127).
+     * @return The set containing only that cell.
+     */
+    static constexpr Bitboard cell(int index) {
+        return index < 64 ? Bitboard(std::uint64_t(1) << index, 0)
+                : Bitboard(0, std::uint64_t(1) << (index - 64));
+    }
+
+    /**
+     * @brief Creates a set containing a single cell.
+     * @param index Linear index of the cell.
+     * @return The set containing only that cell.
+     */
+    static constexpr Bitboard cell(CellIndex index) {
+        return cell(int(index.value()));
+    }
+
+    /**
+     * @brief Creates the set of the first cells, i.e. all cells of a grid.
+     * @param cells The number of cells of the grid (0 to 128).
+     * @return The set of cells 0 to cells - 1.
+     */
+    static constexpr Bitboard firstCells(int cells) {
+        return cells <= 0 ? Bitboard()
+                : cells < 64 ? Bitboard((std::uint64_t(1) << cells) - 1, 0)
+                : cells == 64 ? Bitboard(~std::uint64_t(0), 0)
+                : cells < 128 ? Bitboard(~std::uint64_t(0),
+                        (std::uint64_t(1) << (cells - 64)) - 1)
+                : Bitboard(~std::uint64_t(0), ~std::uint64_t(0));
+    }
+
+    /**
+     * @brief Getter function to retrieve the bits of cells 0 to 63.
+     * @return The low word.
+     */
+    constexpr std::uint64_t getLow() const {
+        return low;
+    }
+
+    /**
+     * @brief Getter function to retrieve the bits of cells 64 to 127.
+     * @return The high word.
+     */
+    constexpr std::uint64_t getHigh() const {
+        return high;
+    }
+
+    /**
+     * @brief Checks whether a cell is in the set.
+     * @param index Linear index of the cell.
+     * @return True if the cell is in the set.
+     */
+    constexpr bool test(int index) const {
+        return index < 64 ? ((low >> index) & 1) != 0
+                : ((high >> (index - 64)) & 1) != 0;
+    }
+
+    /**
+     * @brief Checks whether a cell is in the set.
+     * @param index Linear index of the cell.
+     * @return True if the cell is in the set.
+     */
+    constexpr bool test(CellIndex index) const {
+        return test(int(index.value()));
+    }
+
+    /**
+     * @brief Checks whether the set contains any cell.
+     * @return True if at least one cell is set.
+     */
+    constexpr bool any() const {
+        return (low | high) != 0;
+    }
+
+    /**
+     * @brief Checks whether the set is empty.
+     * @return True if no cell is set.
+     */
+    constexpr bool none() const {
+        return (low | high) == 0;
+    }
+
+    /**
+     * @brief Counts the cells in the set.
+     * @return The number of cells.
+     */
+    constexpr int count() const {
+        return popCount(low) + popCount(high);
+    }
+
+    /**
+     * @brief Finds the cell with the lowest index.
+     * @return The lowest index in the set, or -1 if the set is empty.
+     */
+    constexpr int first() const {
+        return low != 0 ? lowestBit(low)
+                : high != 0 ? 64 + lowestBit(high) : -1;
+    }
+
+    /**
+     * @brief Removes the cell with the lowest index and returns it.
+     * @details Used to iterate over the cells:
+     *          `for (int i = b.popFirst(); i >= 0; i = b.popFirst())`.
+     * @return The removed index, or -1 if the set was empty.
+     */
+    constexpr int popFirst() {
+        if (low != 0) {
+            int index = lowestBit(low);
+            low &= low - 1;
+            return index;
+        }
+        if (high != 0) {
+            int index = 64 + lowestBit(high);
+            high &= high - 1;
+            return index;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Finds the cell of a given rank, i.e. the (rank + 1)-th lowest.
+     * @details Used to draw a uniformly random cell of the set with
+     *          `b.nth(random.below(b.count()))`.
+     * @param rank Number of cells of the set below the wanted one.
+     * @return The index of the cell, or -1 if rank >= count().
+     */
+    constexpr int nth(int rank) const {
+        int lowCount = popCount(low);
+        std::uint64_t word = rank < lowCount ? low : high;
+        int offset = rank < lowCount ? 0 : 64;
+        rank -= rank < lowCount ? 0 : lowCount;
+        if (rank < 0 || rank >= popCount(word)) {
+            return -1;
+        }
+        // Halve the word down to the byte holding the cell
+        for (int width = 32; width >= 8; width /= 2) {
+            std::uint64_t lower = word & ((std::uint64_t(1) << width) - 1);
+            int lowerCount = popCount(lower);
+            if (rank >= lowerCount) {
+                rank -= lowerCount;
+                word >>= width;
+                offset += width;
+            } else {
+                word = lower;
+            }
+        }
+        for (; rank > 0; rank--) {
+            word &= word - 1;
+        }
+        return offset + lowestBit(word);
+    }
+
+    /**
+     * @brief Counts the cells of the set below a cell, the inverse of nth().
+     * @param index The cell (0 to 128).
+     * @return The rank the cell has or would have in the set.
+     */
+    constexpr int rankOf(int index) const {
+        return (*this & firstCells(index)).count();
+    }
+
+    /**
+     * @brief Checks whether this set shares a cell with another set.
+     * @param other The set to compare with.
+     * @return True if the intersection is not empty.
+     */
+    constexpr bool intersects(Bitboard other) const {
+        return ((low & other.low) | (high & other.high)) != 0;
+    }
+
+    /**
+     * @brief Checks whether every cell of this set is in another set.
+     * @param other The possible superset.
+     * @return True if this set is a subset of other.
+     */
+    constexpr bool isSubsetOf(Bitboard other) const {
+        return ((low & ~other.low) | (high & ~other.high)) == 0;
+    }
+
+    /**
+     * @brief Intersection of two sets.
+     * @param other The other set.
+     * @return The resulting set.
+     */
+    constexpr Bitboard operator&(Bitboard other) const {
+        return Bitboard(low & other.low, high & other.high);
+    }
+
+    /**
+     * @brief Union of two sets.
+     * @param other The other set.
+     * @return The resulting set.
+     */
+    constexpr Bitboard operator|(Bitboard other) const {
+        return Bitboard(low | other.low, high | other.high);
+    }
+
+    /**
+     * @brief Symmetric difference of two sets.
+     * @param other The other set.
+     * @return The resulting set.
+     */
+    constexpr Bitboard operator^(Bitboard other) const {
+        return Bitboard(low ^ other.low, high ^ other.high);
+    }
+
+    /**
+     * @brief Complement of the set over all 128 bits; mask it with
+     *        firstCells() to stay on the grid.
+     * @return The resulting set.
+     */
+    constexpr Bitboard operator~() const {
+        return Bitboard(~low, ~high);
+    }
+
+    /**
+     * @brief Keeps only the cells that are also in another set.
+     * @param other The other set.
+     * @return Reference to this set.
+     */
+    constexpr Bitboard& operator&=(Bitboard other) {
+        low &= other.low;
+        high &= other.high;
+        return *this;
+    }
+
+    /**
+     * @brief Adds the cells of another set.
+     * @param other The other set.
+     * @return Reference to this set.
+     */
+    constexpr Bitboard& operator|=(Bitboard other) {
+        low |= other.low;
+        high |= other.high;
+        return *this;
+    }
+
+    /**
+     * @brief Toggles the cells of another set.
+     * @param other The other set.
+     * @return Reference to this set.
+     */
+    constexpr Bitboard& operator^=(Bitboard other) {
+        low ^= other.low;
+        high ^= other.high;
+        return *this;
+    }
+
+    /**
+     * @brief Checks whether two sets contain the same cells.
+     * @param other The other set.
+     * @return True if the sets compare as stated.
+     */
+    constexpr bool operator==(Bitboard other) const {
+        return low == other.low && high == other.high;
+    }
+
+    /**
+     * @brief Checks whether two sets differ in at least one cell.
+     * @param other The other set.
+     * @return True if the sets compare as stated.
+     */
+    constexpr bool operator!=(Bitboard other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Converts the set to grid positions.
+     * @param columns The number of columns of the grid.
+     * @return The positions of all cells in the set.
+     */
+    std::set<GridPosition> toPositions(int columns) const;
+};
+
+/**
+ * @brief Overloads the << operator to print the cells of a set as a 0/1
+ *        string, cell 0 first.
+ * @param lhs Output stream to which the set is written.
+ * @param rhs The set to output.
+ * @return Reference to the output stream.
+ */
+std::ostream& operator<<(std::ostream& lhs, const Bitboard& rhs);
+
+#endif /* BITBOARD_H_ */
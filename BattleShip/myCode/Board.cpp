@@ -12,6 +12,7 @@
  */
 
 #include "Board.h"
+#include <stdexcept>
 
 /**
  * @brief Getter method to retrieve the number of columns in the board.
@@ -64,6 +65,31 @@ Board::Board(int rows, int columns)
 	  opponentGrid{rows, columns} {
 }
 
+/**
+ * @brief Constructor to initialize the board and both grids with a rule set.
+ *
+ * @param rules The board dimensions, fleet and touching rule.
+ */
+Board::Board(const RuleSet& rules)
+    : rows{rules.getRows()}, columns{rules.getColumns()}, ownGrid{rules},
+	  opponentGrid{rules} {
+}
+
+/**
+ * @brief Constructor to initialize the board from copies of two grids.
+ *
+ * @param ownGrid The player's grid.
+ * @param opponentGrid The opponent's grid.
+ * @throws std::invalid_argument if the grids have different rules.
+ */
+Board::Board(const OwnGrid& ownGrid, const OpponentGrid& opponentGrid)
+    : rows{ownGrid.getRows()}, columns{ownGrid.getColumns()},
+	  ownGrid{ownGrid}, opponentGrid{opponentGrid} {
+    if (!(ownGrid.getRules() == opponentGrid.getRules())) {
+        throw std::invalid_argument("Board: grids have different rules");
+    }
+}
+
 /**
  * @brief Getter method to retrieve the player's grid for modification.
  *
@@ -41,6 +41,26 @@ public:
      */
     Board(int rows, int columns);
 
+    /**
+     * @brief Constructor to initialize the board and both grids with a rule
+     *        set.
+     *
+     * @param rules The board dimensions, fleet and touching rule.
+     * @throws std::invalid_argument if the rule set is not valid.
+     */
+    explicit Board(const RuleSet& rules);
+
+    /**
+     * @brief Constructor to initialize the board from copies of two grids.
+     *
+     * @details Both grids must have been built from the same rules.
+     *
+     * @param ownGrid The player's grid.
+     * @param opponentGrid The opponent's grid.
+     * @throws std::invalid_argument if the grids have different rules.
+     */
+    Board(const OwnGrid& ownGrid, const OpponentGrid& opponentGrid);
+
     /**
      * @brief Getter method to retrieve the number of columns in the board.
      *
@@ -0,0 +1,442 @@
+/**
+ * @file BoardCheckpoint.cpp
+ * @brief Implementation file for the BoardCheckpoint class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "BoardCheckpoint.h"
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+
+/// Offset of the own grid's planes.
+static constexpr size_t OWN_PLANES = BoardCheckpoint::HEADER_SIZE;
+/// Offset of the opponent grid's planes.
+static constexpr size_t OPPONENT_PLANES = OWN_PLANES + 32;
+/// Offset of the placed ships.
+static constexpr size_t OWN_SHIPS = OPPONENT_PLANES + 32;
+/// Offset of the sunken opponent ships.
+static constexpr size_t SUNKEN_SHIPS = OWN_SHIPS
+        + 2 * BoardCheckpoint::MAX_SHIPS;
+
+/**
+ * @brief Stores a bit plane as two little endian words.
+ *
+ * @param plane The plane.
+ * @param bytes The first of the 16 bytes to write.
+ */
+static void writePlane(Bitboard plane, unsigned char* bytes) {
+    uint64_t words[2] = {plane.getLow(), plane.getHigh()};
+    for (int byte = 0; byte < 16; byte++) {
+        bytes[byte] = static_cast<unsigned char>(
+                words[byte / 8] >> (byte % 8 * 8));
+    }
+}
+
+/**
+ * @brief Loads a bit plane stored by writePlane().
+ *
+ * @param bytes The first of the 16 bytes to read.
+ * @return The plane.
+ */
+static Bitboard readPlane(const unsigned char* bytes) {
+    uint64_t words[2] = {0, 0};
+    for (int byte = 0; byte < 16; byte++) {
+        words[byte / 8] |= uint64_t(bytes[byte]) << (byte % 8 * 8);
+    }
+    return Bitboard{words[0], words[1]};
+}
+
+/**
+ * @brief Stores a list of ships.
+ *
+ * @param ships The ships, at most MAX_SHIPS.
+ * @param columns Columns of the grid.
+ * @param bytes The first byte to write.
+ */
+static void writeShips(const vector<Ship>& ships, int columns,
+        unsigned char* bytes) {
+    for (const Ship& ship : ships) {
+        int bow = CellIndex::fromPosition(ship.getBow(), columns).value();
+        int stern = CellIndex::fromPosition(ship.getStern(), columns).value();
+        bool vertical = ship.getBow().getColumn()
+                == ship.getStern().getColumn() && ship.length() > 1;
+        *bytes++ = static_cast<unsigned char>(ship.length());
+        *bytes++ = static_cast<unsigned char>(min(bow, stern) << 1
+                | vertical);
+    }
+}
+
+/**
+ * @brief Checks a stored ship and computes the cells it covers.
+ *
+ * @param bytes The two bytes of the ship.
+ * @param rules The rules of the grid.
+ * @param mask Receives the covered cells.
+ * @return false if the ship does not fit the grid.
+ */
+static bool readShipMask(const unsigned char* bytes, const RuleSet& rules,
+        Bitboard& mask) {
+    int columns = rules.getColumns();
+    int length = bytes[0];
+    int first = bytes[1] >> 1;
+    int step = (bytes[1] & 1) != 0 ? columns : 1;
+    int last = first + (length - 1) * step;
+    if (length < 1 || last >= rules.getCells()
+            || (step == 1 && first / columns != last / columns)) {
+        return false;
+    }
+    mask = Bitboard{};
+    for (int cell = first; cell <= last; cell += step) {
+        mask |= Bitboard::cell(cell);
+    }
+    return true;
+}
+
+/**
+ * @brief Decodes a stored ship checked by readShipMask().
+ *
+ * @param bytes The two bytes of the ship.
+ * @param columns Columns of the grid.
+ * @return The ship.
+ */
+static Ship readShip(const unsigned char* bytes, int columns) {
+    int first = bytes[1] >> 1;
+    int step = (bytes[1] & 1) != 0 ? columns : 1;
+    int last = first + (bytes[0] - 1) * step;
+    return Ship{CellIndex(uint16_t(first)).toPosition(columns),
+            CellIndex(uint16_t(last)).toPosition(columns)};
+}
+
+/**
+ * @brief Moves every cell of a set to a higher index.
+ *
+ * @param cells The set.
+ * @param shift How far the cells move (0 to 127).
+ * @return The moved set; cells moved past index 127 are dropped.
+ */
+static Bitboard shiftUp(Bitboard cells, int shift) {
+    uint64_t low = cells.getLow();
+    uint64_t high = cells.getHigh();
+    if (shift >= 64) {
+        return Bitboard{0, low << (shift - 64)};
+    }
+    return shift == 0 ? cells
+            : Bitboard{low << shift, high << shift | low >> (64 - shift)};
+}
+
+/**
+ * @brief Moves every cell of a set to a lower index.
+ *
+ * @param cells The set.
+ * @param shift How far the cells move (0 to 127).
+ * @return The moved set; cells moved below index 0 are dropped.
+ */
+static Bitboard shiftDown(Bitboard cells, int shift) {
+    uint64_t low = cells.getLow();
+    uint64_t high = cells.getHigh();
+    if (shift >= 64) {
+        return Bitboard{high >> (shift - 64), 0};
+    }
+    return shift == 0 ? cells
+            : Bitboard{low >> shift | high << (64 - shift), high >> shift};
+}
+
+/**
+ * @brief Computes the cells blocked by ships covering a set of cells.
+ *
+ * @details Equal to the union of Ship::blockedMask() of the ships, but
+ *          computed for all of them at once with a few shifts.
+ *
+ * @param cells The cells covered by the ships.
+ * @param rules The rules of the grid.
+ * @return The covered cells and, if ships may not touch, their neighbours.
+ */
+static Bitboard blockedCells(Bitboard cells, const RuleSet& rules) {
+    if (rules.mayShipsTouch()) {
+        return cells;
+    }
+    int columns = rules.getColumns();
+    Bitboard firstColumn;
+    for (int cell = 0; cell < rules.getCells(); cell += columns) {
+        firstColumn |= Bitboard::cell(cell);
+    }
+    Bitboard lastColumn = shiftDown(firstColumn, 1)
+            | Bitboard::cell(rules.getCells() - 1);
+    Bitboard row = cells | (shiftUp(cells, 1) & ~firstColumn)
+            | (shiftDown(cells, 1) & ~lastColumn);
+    return (row | shiftUp(row, columns) | shiftDown(row, columns))
+            & rules.boardMask();
+}
+
+/**
+ * @brief Default constructor creating a checkpoint of an empty standard
+ *        board.
+ */
+BoardCheckpoint::BoardCheckpoint() : BoardCheckpoint{Board{STANDARD_RULES}} {
+}
+
+/**
+ * @brief Constructor to take a snapshot of a board.
+ *
+ * @param board The board.
+ * @throws std::invalid_argument if a quota of the board's rules is above
+ *         255.
+ */
+BoardCheckpoint::BoardCheckpoint(const Board& board) : bytes{} {
+    const OwnGrid& own = board.getOwnGrid();
+    const OpponentGrid& opponent = board.getOpponentGrid();
+    const RuleSet& rules = own.getRules();
+    bytes[0] = VERSION;
+    bytes[1] = static_cast<unsigned char>(rules.getRows());
+    bytes[2] = static_cast<unsigned char>(rules.getColumns());
+    bytes[3] = rules.mayShipsTouch() ? 1 : 0;
+    for (int length = 0; length <= Ship::MAX_LENGTH; length++) {
+        if (rules.getQuota(length) > 255) {
+            throw invalid_argument("BoardCheckpoint: quota above 255");
+        }
+        bytes[4 + length] = static_cast<unsigned char>(
+                rules.getQuota(length));
+    }
+    // Ships cover at least MIN_LENGTH cells each, so both lists fit
+    bytes[10] = static_cast<unsigned char>(own.getShips().size());
+    bytes[11] = static_cast<unsigned char>(
+            opponent.getSunkenShip().size());
+
+    writePlane(own.occupiedCells, &bytes[OWN_PLANES]);
+    writePlane(own.shotMask, &bytes[OWN_PLANES + 16]);
+    writePlane(opponent.lowPlane, &bytes[OPPONENT_PLANES]);
+    writePlane(opponent.highPlane, &bytes[OPPONENT_PLANES + 16]);
+    writeShips(own.getShips(), rules.getColumns(), &bytes[OWN_SHIPS]);
+    writeShips(opponent.getSunkenShip(), rules.getColumns(),
+            &bytes[SUNKEN_SHIPS]);
+}
+
+/**
+ * @brief Constructor to wrap stored bytes.
+ *
+ * @param bytes A snapshot from getBytes().
+ */
+BoardCheckpoint::BoardCheckpoint(
+        const std::array<unsigned char, SIZE>& bytes) : bytes{bytes} {
+}
+
+/**
+ * @brief Getter method to retrieve the encoded snapshot.
+ *
+ * @return The SIZE bytes of the snapshot.
+ */
+const array<unsigned char, BoardCheckpoint::SIZE>&
+BoardCheckpoint::getBytes() const {
+    return bytes;
+}
+
+/**
+ * @brief Reads the rules from the header.
+ *
+ * @param rules Receives the rules.
+ * @return false if the header is not a valid version 1 header.
+ */
+bool BoardCheckpoint::readRules(RuleSet& rules) const {
+    RuleSet::Quota quota{};
+    for (int length = 0; length <= Ship::MAX_LENGTH; length++) {
+        quota[length] = bytes[4 + length];
+    }
+    RuleSet stored{bytes[1], bytes[2], quota, (bytes[3] & 1) != 0};
+    if (bytes[0] != VERSION || stored.isValid() == false
+            || bytes[10] > MAX_SHIPS || bytes[11] > MAX_SHIPS) {
+        return false;
+    }
+    rules = stored;
+    return true;
+}
+
+/**
+ * @brief Getter method to retrieve the rules of the snapshot.
+ *
+ * @return The rules, or the standard rules if the bytes are damaged.
+ */
+RuleSet BoardCheckpoint::getRules() const {
+    RuleSet rules = STANDARD_RULES;
+    readRules(rules);
+    return rules;
+}
+
+/**
+ * @brief Restores the snapshot into a board.
+ *
+ * @details All ships are decoded and checked before the board is touched.
+ *          The ships' masks come straight from the ship table and the
+ *          blocked cells from one dilation of the occupied plane, so no
+ *          placement is validated again. The grids' vectors keep their
+ *          capacity; restoring into a board of the same rules does not
+ *          allocate.
+ *
+ * @param board Receives the snapshot.
+ * @return false if the bytes are damaged; the board is unchanged then.
+ */
+bool BoardCheckpoint::restore(Board& board) const {
+    RuleSet rules = STANDARD_RULES;
+    if (readRules(rules) == false) {
+        return false;
+    }
+    Bitboard onGrid = rules.boardMask();
+    Bitboard occupied = readPlane(&bytes[OWN_PLANES]);
+    Bitboard shots = readPlane(&bytes[OWN_PLANES + 16]);
+    Bitboard low = readPlane(&bytes[OPPONENT_PLANES]);
+    Bitboard high = readPlane(&bytes[OPPONENT_PLANES + 16]);
+    if (!(occupied | shots | low | high).isSubsetOf(onGrid)) {
+        return false;
+    }
+
+    // The placed ships must fit the quota and cover exactly the occupied
+    // cells without overlapping
+    int ownCount = bytes[10];
+    int sunkenCount = bytes[11];
+    RuleSet::Quota remaining = rules.getQuotas();
+    array<Bitboard, MAX_SHIPS> masks;
+    Bitboard shipCells;
+    for (int index = 0; index < ownCount; index++) {
+        const unsigned char* ship = &bytes[OWN_SHIPS + 2 * index];
+        if (ship[0] > Ship::MAX_LENGTH || remaining[ship[0]]-- <= 0
+                || readShipMask(ship, rules, masks[index]) == false
+                || shipCells.intersects(masks[index])) {
+            return false;
+        }
+        shipCells |= masks[index];
+    }
+    if (shipCells != occupied) {
+        return false;
+    }
+    Bitboard sunkenCells;
+    for (int index = 0; index < sunkenCount; index++) {
+        if (readShipMask(&bytes[SUNKEN_SHIPS + 2 * index], rules,
+                sunkenCells) == false) {
+            return false;
+        }
+    }
+
+    // The bytes are consistent; fill the grids directly
+    if (!(board.getOwnGrid().getRules() == rules)) {
+        board = Board{rules};
+    }
+    int columns = rules.getColumns();
+    OwnGrid& own = board.getOwnGrid();
+    own.reset();
+    own.shipTypes = remaining;
+    own.shotMask = shots;
+    own.occupiedCells = occupied;
+    own.blockedCells = blockedCells(occupied, rules);
+    for (int index = 0; index < ownCount; index++) {
+        Bitboard cells = masks[index];
+        for (int cell = cells.popFirst(); cell >= 0;
+                cell = cells.popFirst()) {
+            own.cellShips[cell] = static_cast<signed char>(index);
+        }
+        own.ships.push_back(readShip(&bytes[OWN_SHIPS + 2 * index],
+                columns));
+        own.shipHits.push_back((masks[index] & shots).count());
+    }
+    own.rehash();
+
+    OpponentGrid& opponent = board.getOpponentGrid();
+    opponent.reset();
+    opponent.lowPlane = low;
+    opponent.highPlane = high;
+    for (int index = 0; index < sunkenCount; index++) {
+        opponent.sunkenShip.push_back(readShip(
+                &bytes[SUNKEN_SHIPS + 2 * index], columns));
+    }
+    opponent.rebuildInference();
+    opponent.rehash();
+    return true;
+}
+
+/**
+ * @brief Creates a board from the snapshot.
+ *
+ * @return The board; an empty standard board if the bytes are damaged.
+ */
+Board BoardCheckpoint::toBoard() const {
+    Board board{getRules()};
+    if (restore(board) == false) {
+        board = Board{STANDARD_RULES};
+    }
+    return board;
+}
+
+/**
+ * @brief Describes the snapshot for debugging.
+ *
+ * @return The description, several lines.
+ */
+string BoardCheckpoint::toText() const {
+    RuleSet rules = STANDARD_RULES;
+    ostringstream text;
+    if (readRules(rules) == false) {
+        text << "BoardCheckpoint: damaged" << endl;
+        return text.str();
+    }
+    text << "BoardCheckpoint " << rules.getRows() << "x"
+            << rules.getColumns() << " quota";
+    for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+            length++) {
+        text << " " << rules.getQuota(length);
+    }
+    text << (rules.mayShipsTouch() ? " touching" : "") << endl;
+
+    Bitboard occupied = readPlane(&bytes[OWN_PLANES]);
+    Bitboard shots = readPlane(&bytes[OWN_PLANES + 16]);
+    Bitboard low = readPlane(&bytes[OPPONENT_PLANES]);
+    Bitboard high = readPlane(&bytes[OPPONENT_PLANES + 16]);
+    text << "  ";
+    for (int side = 0; side < 2; side++) {
+        for (int column = 1; column <= rules.getColumns(); column++) {
+            text << column % 10;
+        }
+        text << "  ";
+    }
+    text << endl;
+    for (int row = 0; row < rules.getRows(); row++) {
+        text << char('A' + row) << " ";
+        for (int column = 0; column < rules.getColumns(); column++) {
+            int cell = row * rules.getColumns() + column;
+            text << (occupied.test(cell) ? (shots.test(cell) ? 'X' : '#')
+                    : (shots.test(cell) ? '~' : '.'));
+        }
+        text << "  ";
+        for (int column = 0; column < rules.getColumns(); column++) {
+            int cell = row * rules.getColumns() + column;
+            text << ".~xS"[int(low.test(cell)) + 2 * int(high.test(cell))];
+        }
+        text << endl;
+    }
+
+    const char* titles[2] = {"ships:", "sunken:"};
+    int counts[2] = {bytes[10], bytes[11]};
+    size_t offsets[2] = {OWN_SHIPS, SUNKEN_SHIPS};
+    for (int list = 0; list < 2; list++) {
+        text << titles[list];
+        for (int ship = 0; ship < counts[list]; ship++) {
+            const unsigned char* stored = &bytes[offsets[list] + 2 * ship];
+            Bitboard cells;
+            if (readShipMask(stored, rules, cells)) {
+                Ship decoded = readShip(stored, rules.getColumns());
+                text << " " << string(decoded.getBow()) << "-"
+                        << string(decoded.getStern());
+            } else {
+                text << " ?";
+            }
+        }
+        text << endl;
+    }
+    return text.str();
+}
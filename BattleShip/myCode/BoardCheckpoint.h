@@ -0,0 +1,135 @@
+/**
+ * @file BoardCheckpoint.h
+ * @brief Header file for the BoardCheckpoint class, a fixed-size binary
+ *        snapshot of a Board that can be stored, sent and restored quickly.
+ *
+ * @details The snapshot is SIZE bytes long for every rule set:
+ *          - 12 bytes header: version, rows, columns, flags (bit 0: ships may
+ *            touch), the quota of lengths 0 to Ship::MAX_LENGTH and the
+ *            number of placed ships and of sunken opponent ships.
+ *          - 2 bits per cell of the own grid, as two 128 bit planes: cells
+ *            with a ship and cells that were shot at.
+ *          - 2 bits per cell of the opponent grid, as the two planes of
+ *            OpponentGrid::CellState.
+ *          - MAX_SHIPS placed ships and MAX_SHIPS sunken opponent ships of
+ *            2 bytes each: the length and (first cell << 1 | vertical).
+ *          Bit planes are stored as little endian words.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef BOARDCHECKPOINT_H_
+#define BOARDCHECKPOINT_H_
+
+#include "Board.h"
+#include <array>
+#include <cstddef>
+#include <string>
+
+/**
+ * @class BoardCheckpoint
+ * @brief Snapshot of both grids of a Board.
+ *
+ * @details A checkpoint stores the rules, the placed ships, the shots taken
+ *          at them and the results of the own shots, including the ships
+ *          known to be sunk. The remaining ship quotas, the derived masks
+ *          and the grids' hashes are recomputed on restore. The undo history
+ *          is not stored; a restored board starts with an empty one.
+ *
+ *          restore() copies bit planes and re-adds the ships directly,
+ *          without validating placements or replaying shots, and reuses the
+ *          board's memory if the rules are unchanged.
+ */
+class BoardCheckpoint {
+public:
+    static constexpr int MAX_SHIPS = Bitboard::CAPACITY / Ship::MIN_LENGTH;
+                                         ///< Ships of each list that fit.
+    static constexpr std::size_t HEADER_SIZE = 12; ///< Bytes of the header.
+    static constexpr std::size_t SIZE = HEADER_SIZE + 2 * 32
+            + 2 * 2 * MAX_SHIPS;         ///< Bytes of every checkpoint.
+    static constexpr unsigned char VERSION = 1; ///< Version of the layout.
+
+private:
+    std::array<unsigned char, SIZE> bytes; ///< The encoded snapshot.
+
+    /**
+     * @brief Reads the rules from the header.
+     * @param rules Receives the rules.
+     * @return false if the header is not a valid version 1 header.
+     */
+    bool readRules(RuleSet& rules) const;
+
+public:
+    /**
+     * @brief Default constructor creating a checkpoint of an empty standard
+     *        board.
+     */
+    BoardCheckpoint();
+
+    /**
+     * @brief Constructor to take a snapshot of a board.
+     *
+     * @param board The board.
+     * @throws std::invalid_argument if a quota of the board's rules is above
+     *         255.
+     */
+    explicit BoardCheckpoint(const Board& board);
+
+    /**
+     * @brief Constructor to wrap stored bytes.
+     *
+     * @details The bytes are checked by restore().
+     *
+     * @param bytes A snapshot from getBytes().
+     */
+    explicit BoardCheckpoint(const std::array<unsigned char, SIZE>& bytes);
+
+    /**
+     * @brief Getter method to retrieve the encoded snapshot.
+     *
+     * @return The SIZE bytes of the snapshot.
+     */
+    const std::array<unsigned char, SIZE>& getBytes() const;
+
+    /**
+     * @brief Getter method to retrieve the rules of the snapshot.
+     *
+     * @return The rules, or the standard rules if the bytes are damaged.
+     */
+    RuleSet getRules() const;
+
+    /**
+     * @brief Restores the snapshot into a board.
+     *
+     * @details The board is replaced by an empty board of the snapshot's
+     *          rules first if its rules differ.
+     *
+     * @param board Receives the snapshot.
+     * @return false if the bytes are damaged; the board is unchanged then.
+     */
+    bool restore(Board& board) const;
+
+    /**
+     * @brief Creates a board from the snapshot.
+     *
+     * @return The board; an empty standard board if the bytes are damaged.
+     */
+    Board toBoard() const;
+
+    /**
+     * @brief Describes the snapshot for debugging.
+     *
+     * @details Both grids side by side ('.' unknown or untouched water, '~'
+     *          miss, '#' ship, 'X' hit ship, 'x' hit, 'S' sunk) followed by
+     *          the ship lists.
+     *
+     * @return The description, several lines.
+     */
+    std::string toText() const;
+};
+
+#endif /* BOARDCHECKPOINT_H_ */
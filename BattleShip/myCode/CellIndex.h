@@ -0,0 +1,156 @@
+/**
+ * @file CellIndex.h
+ * @brief Header file for the CellIndex class, a packed linear index of a grid
+ *        cell.
+ *
+ * @details A GridPosition stores the row as a character and the column as an
+ *          integer, which is convenient for input and output but expensive as
+ *          a container key. CellIndex encodes the same cell as a single 16 bit
+ *          value (row * columns + column, both zero based), so that state
+ *          kept per cell can live in flat arrays or bit masks. All
+ *          conversions are constexpr and therefore free when the grid size is
+ *          known at compile time.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef CELLINDEX_H_
+#define CELLINDEX_H_
+
+#include "GridPosition.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @class CellIndex
+ * @brief Linear index of a cell on a grid with a given number of columns.
+ *
+ * @details The index is only meaningful together with the column count of the
+ *          grid it was created for. Index 0 is "A1", index `columns` is "B1".
+ */
+class CellIndex {
+private:
+    std::uint16_t index; ///< Zero based linear index of the cell.
+
+public:
+    /**
+     * @brief Constructor to create the index of the first cell ("A1").
+     */
+    constexpr CellIndex() : index{0} {}
+
+    /**
+     * @brief Constructor to create a cell index from its raw value.
+     * @param index The zero based linear index.
+     */
+    constexpr explicit CellIndex(std::uint16_t index) : index{index} {}
+
+    /**
+     * @brief Creates the index of the cell at a zero based row and column.
+     * @param rowIndex Zero based row (0 for 'A').
+     * @param columnIndex Zero based column (0 for column 1).
+     * @param columns The number of columns of the grid.
+     * @return The linear index of the cell.
+     */
+    static constexpr CellIndex fromRowColumn(int rowIndex, int columnIndex,
+            int columns) {
+        return CellIndex(std::uint16_t(rowIndex * columns + columnIndex));
+    }
+
+    /**
+     * @brief Converts a grid position to its linear index.
+     * @details The position must lie on the grid (see
+     *          GridPosition::isInside()).
+     * @param position The grid position to convert.
+     * @param columns The number of columns of the grid.
+     * @return The linear index of the position.
+     */
+    static constexpr CellIndex fromPosition(GridPosition position,
+            int columns) {
+        return fromRowColumn(position.getRow() - 'A',
+                position.getColumn() - 1, columns);
+    }
+
+    /**
+     * @brief Getter function to retrieve the raw index value.
+     * @return The zero based linear index.
+     */
+    constexpr std::uint16_t value() const {
+        return index;
+    }
+
+    /**
+     * @brief Decodes the zero based row of the cell.
+     * @param columns The number of columns of the grid.
+     * @return The zero based row (0 for 'A').
+     */
+    constexpr int rowIndex(int columns) const {
+        return index / columns;
+    }
+
+    /**
+     * @brief Decodes the zero based column of the cell.
+     * @param columns The number of columns of the grid.
+     * @return The zero based column (0 for column 1).
+     */
+    constexpr int columnIndex(int columns) const {
+        return index % columns;
+    }
+
+    /**
+     * @brief Converts the index back to a grid position.
+     * @param columns The number of columns of the grid.
+     * @return The grid position of the cell.
+     */
+    constexpr GridPosition toPosition(int columns) const {
+        return GridPosition(char('A' + rowIndex(columns)),
+                columnIndex(columns) + 1);
+    }
+
+    /**
+     * @brief Overloads the equality operator to compare two cell indices.
+     * @param other Another CellIndex to compare.
+     * @return True if both indices refer to the same cell.
+     */
+    constexpr bool operator==(CellIndex other) const {
+        return index == other.index;
+    }
+
+    /**
+     * @brief Overloads the inequality operator to compare two cell indices.
+     * @param other Another CellIndex to compare.
+     * @return True if the indices refer to different cells.
+     */
+    constexpr bool operator!=(CellIndex other) const {
+        return index != other.index;
+    }
+
+    /**
+     * @brief Overloads the less-than operator; orders cells like GridPosition.
+     * @param other Another CellIndex to compare.
+     * @return True if this cell comes before the other cell.
+     */
+    constexpr bool operator<(CellIndex other) const {
+        return index < other.index;
+    }
+};
+
+static_assert(sizeof(CellIndex) == 2, "CellIndex must stay a 16 bit value");
+
+/**
+ * @brief Hash specialization so CellIndex can key unordered containers.
+ */
+namespace std {
+template<>
+struct hash<CellIndex> {
+    size_t operator()(CellIndex cell) const noexcept {
+        return cell.value();
+    }
+};
+}
+
+#endif /* CELLINDEX_H_ */
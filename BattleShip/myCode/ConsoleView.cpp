@@ -79,45 +79,45 @@ void ConsoleView::print() const {
                                         vector<char>(board->getColumns(), '~'));
 
     // Mark player ship positions with '#'
-    for (const auto& ship : board->getOwnGrid().getShips()) {
-        for (const auto& shipOccupiedPos : ship.occupiedArea()) {
-            playerBoardGrid[shipOccupiedPos.getRow() - 'A']
-                           [shipOccupiedPos.getColumn() - 1] = '#';
+    const OwnGrid& ownGrid = board->getOwnGrid();
+    for (int rowIndex = 0; rowIndex < board->getRows(); rowIndex++) {
+        for (int columnIndex = 0; columnIndex < board->getColumns();
+             columnIndex++) {
+            if (ownGrid.shipIdAt(CellIndex::fromRowColumn(rowIndex,
+                    columnIndex, board->getColumns())) != OwnGrid::NO_SHIP) {
+                playerBoardGrid[rowIndex][columnIndex] = '#';
+            }
         }
     }
 
     // Update player board with shots
-    for (const auto& shotsPosition : board->getOwnGrid().getShotAt()) {
-        bool isHit = false;
-        for (const auto& shipOccupiedPos : board->getOwnGrid().getShips()) {
-            if (shipOccupiedPos.occupiedArea().count(shotsPosition)) {
-                isHit = true;
-                break;
-            }
-        }
-        if (isHit) {
-            playerBoardGrid[shotsPosition.getRow() - 'A']
-                           [shotsPosition.getColumn() - 1] = 'O'; // Hit
+    Bitboard shots = ownGrid.getShotMask();
+    for (int cell = shots.popFirst(); cell >= 0; cell = shots.popFirst()) {
+        CellIndex shot{static_cast<uint16_t>(cell)};
+        int rowIndex = shot.rowIndex(board->getColumns());
+        int columnIndex = shot.columnIndex(board->getColumns());
+        if (ownGrid.shipIdAt(shot) != OwnGrid::NO_SHIP) {
+            playerBoardGrid[rowIndex][columnIndex] = 'O'; // Hit
         } else {
-            playerBoardGrid[shotsPosition.getRow() - 'A']
-                           [shotsPosition.getColumn() - 1] = '^'; // Miss
+            playerBoardGrid[rowIndex][columnIndex] = '^'; // Miss
         }
     }
 
     // Update opponent board with shots
-    for (const auto& shot : board->getOpponentGrid().getShots()) {
-        const GridPosition& shotPosition = shot.first;
-        const Shot::Impact& impact = shot.second;
-
-        if (impact == Shot::Impact::SUNKEN) {
-            opponentBoardGrid[shotPosition.getRow() - 'A']
-                             [shotPosition.getColumn() - 1] = '#';
-        } else if (impact == Shot::Impact::HIT) {
-            opponentBoardGrid[shotPosition.getRow() - 'A']
-                             [shotPosition.getColumn() - 1] = 'O';
-        } else if (impact == Shot::Impact::NONE) {
-            opponentBoardGrid[shotPosition.getRow() - 'A']
-                             [shotPosition.getColumn() - 1] = '^';
+    const OpponentGrid& opponentGrid = board->getOpponentGrid();
+    for (int rowIndex = 0; rowIndex < board->getRows(); rowIndex++) {
+        for (int columnIndex = 0; columnIndex < board->getColumns();
+             columnIndex++) {
+            OpponentGrid::CellState state = opponentGrid.getCellState(
+                CellIndex::fromRowColumn(rowIndex, columnIndex,
+                                         board->getColumns()));
+            if (state == OpponentGrid::SUNK) {
+                opponentBoardGrid[rowIndex][columnIndex] = '#';
+            } else if (state == OpponentGrid::HIT) {
+                opponentBoardGrid[rowIndex][columnIndex] = 'O';
+            } else if (state == OpponentGrid::MISS) {
+                opponentBoardGrid[rowIndex][columnIndex] = '^';
+            }
         }
     }
 
@@ -0,0 +1,575 @@
+/**
+ * @file EndgameSolver.cpp
+ * @brief Implementation file for the EndgameSolver class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "EndgameSolver.h"
+#include "FleetEnumerator.h"
+#include "Zobrist.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+/// Value of a shot that was not searched to the end.
+static constexpr double UNSOLVED = numeric_limits<double>::infinity();
+
+/// Values closer than this are equal.
+static constexpr double EPSILON = 1e-9;
+
+/**
+ * @struct EndgameWorker
+ * @brief Everything one worker changes while searching.
+ *
+ * @details Aligned to a cache line, so the node counters of different
+ *          workers are never on the same line.
+ */
+struct alignas(64) EndgameWorker {
+    /// Layouts of the states on the search path; the layouts of a state are
+    /// a range of the vector and its children's ranges follow it.
+    std::vector<int> stack;
+    long pending = 0; ///< Nodes not yet added to EndgameSearch::nodes.
+};
+
+/**
+ * @struct EndgameSearch
+ * @brief The layouts and limits shared by all workers of one search.
+ */
+struct EndgameSearch {
+    /**
+     * @enum Outcome
+     * @brief What a shot reports for a layout.
+     */
+    enum Outcome {
+        MISS,    /**< No ship on the cell. */
+        HIT,     /**< A ship that still has open cells. */
+        SUNKEN,  /**< The last open cell of a ship, but not of the fleet. */
+        FINISHED /**< The last open cell of the fleet. */
+    };
+
+    static constexpr int OUTCOMES = 3; ///< Outcomes that continue the game.
+
+    int fleetSize = 0; ///< Ships in each layout.
+    std::vector<Bitboard> occupied; ///< Cells of each layout.
+    std::vector<Bitboard> ships;    ///< Cells of each ship, fleetSize per
+                                    ///< layout.
+    std::vector<std::uint64_t> keys; ///< Key of each layout.
+    TranspositionTable<double>& memo; ///< Values of searched states.
+    long maxNodes;  ///< Node limit.
+    bool timed;     ///< True if deadline applies.
+    std::chrono::steady_clock::time_point deadline; ///< Time limit.
+    std::atomic<long> nodes{0};        ///< Nodes counted so far.
+    std::atomic<bool> aborted{false};  ///< True once a limit is reached.
+
+    /**
+     * @brief Constructor to start a search.
+     * @param memo Values of searched states.
+     * @param budget The node and time limit.
+     */
+    EndgameSearch(TranspositionTable<double>& memo,
+            const EndgameBudget& budget)
+        : memo{memo}, maxNodes{budget.maxNodes},
+          timed{budget.maxTime.count() > 0},
+          deadline{std::chrono::steady_clock::now() + budget.maxTime} {
+    }
+
+    /**
+     * @brief Adds a layout.
+     * @param layout The ship cells of the layout.
+     */
+    void add(const std::vector<Bitboard>& layout) {
+        Bitboard cells;
+        std::uint64_t key = 0;
+        for (Bitboard ship : layout) {
+            cells |= ship;
+            key ^= Zobrist::shipKey(ship);
+            ships.push_back(ship);
+        }
+        occupied.push_back(cells);
+        keys.push_back(Zobrist::mix(key));
+    }
+
+    /**
+     * @brief Finds the report of a shot for a layout.
+     * @param layout The layout.
+     * @param cell The target.
+     * @param shot The cells shot, including the target.
+     * @return The impact of the shot.
+     */
+    Outcome outcome(int layout, int cell, Bitboard shot) const {
+        if (occupied[layout].test(cell) == false) {
+            return MISS;
+        }
+        if (occupied[layout].isSubsetOf(shot)) {
+            return FINISHED;
+        }
+        const Bitboard* ship = &ships[size_t(layout) * fleetSize];
+        while (ship->test(cell) == false) {
+            ship++;
+        }
+        return ship->isSubsetOf(shot) ? SUNKEN : HIT;
+    }
+
+    /**
+     * @brief Adds the pending nodes of a worker and checks the limits.
+     * @param worker The worker.
+     */
+    void flush(EndgameWorker& worker) {
+        long total = nodes.fetch_add(worker.pending,
+                std::memory_order_relaxed) + worker.pending;
+        worker.pending = 0;
+        if (total > maxNodes
+                || (timed && std::chrono::steady_clock::now() >= deadline)) {
+            aborted.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Counts a node.
+     * @param worker The worker visiting it.
+     * @return true if the search must stop.
+     */
+    bool charge(EndgameWorker& worker) {
+        if (++worker.pending >= EndgameSolver::CHECK_NODES) {
+            flush(worker);
+        }
+        return aborted.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @struct EndgameTargets
+ * @brief The cells worth shooting in a state, most likely ship first.
+ */
+struct EndgameTargets {
+    /// Number of layouts with a ship on each open cell.
+    std::array<int, Bitboard::CAPACITY> counts;
+    std::array<int, Bitboard::CAPACITY> cells; ///< The targets, sorted.
+    int size = 0;        ///< Number of targets.
+    long openCells = 0;  ///< Open ship cells of all layouts together.
+    bool settled = true; ///< True if all layouts have the same open cells.
+    Bitboard common;     ///< The open cells of the first layout.
+};
+
+/**
+ * @brief Collects the cells that hold a ship in at least one layout.
+ *
+ * @param search The layouts.
+ * @param stack The layouts of the state are stack[begin] to stack[end - 1].
+ * @param begin First position of the state's layouts.
+ * @param end Position after its last layout.
+ * @param shot The cells shot so far.
+ * @param targets Receives the cells and counts.
+ */
+static void rankTargets(const EndgameSearch& search, const vector<int>& stack,
+        size_t begin, size_t end, Bitboard shot, EndgameTargets& targets) {
+    targets.counts.fill(0);
+    targets.common = search.occupied[stack[begin]] & ~shot;
+    Bitboard any;
+    for (size_t position = begin; position < end; position++) {
+        Bitboard open = search.occupied[stack[position]] & ~shot;
+        targets.settled = targets.settled && open == targets.common;
+        any |= open;
+        for (int cell = open.popFirst(); cell >= 0; cell = open.popFirst()) {
+            targets.counts[cell]++;
+            targets.openCells++;
+        }
+    }
+    for (int cell = any.popFirst(); cell >= 0; cell = any.popFirst()) {
+        targets.cells[targets.size++] = cell;
+    }
+    sort(targets.cells.begin(), targets.cells.begin() + targets.size,
+            [&](int first, int second) {
+                return targets.counts[first] > targets.counts[second]
+                        || (targets.counts[first] == targets.counts[second]
+                            && first < second);
+            });
+}
+
+static double stateValue(EndgameSearch& search, EndgameWorker& worker,
+        size_t begin, size_t end, Bitboard shot, uint64_t shotKey,
+        uint64_t layoutsKey);
+
+/**
+ * @brief Computes the expected number of shots if a cell is shot next.
+ *
+ * @details The layouts are split by the outcome of the shot and each part is
+ *          searched. The search stops as soon as the value is known to be
+ *          above the ceiling.
+ *
+ * @param search The layouts and limits.
+ * @param worker The calling worker.
+ * @param begin First position of the state's layouts in the worker's stack.
+ * @param end Position after its last layout.
+ * @param shot The cells shot so far.
+ * @param shotKey The key of the cells shot so far.
+ * @param cell The target.
+ * @param ceiling Values above it are not needed.
+ * @return The expected number of shots including this one, or UNSOLVED if
+ *         it is above the ceiling.
+ */
+static double shotValue(EndgameSearch& search, EndgameWorker& worker,
+        size_t begin, size_t end, Bitboard shot, uint64_t shotKey, int cell,
+        double ceiling) {
+    vector<int>& stack = worker.stack;
+    Bitboard next = shot | Bitboard::cell(cell);
+    array<size_t, EndgameSearch::OUTCOMES> sizes{};
+    array<uint64_t, EndgameSearch::OUTCOMES> keys{};
+    array<long, EndgameSearch::OUTCOMES> openCells{};
+    for (size_t position = begin; position < end; position++) {
+        int layout = stack[position];
+        int outcome = search.outcome(layout, cell, next);
+        if (outcome != EndgameSearch::FINISHED) {
+            sizes[outcome]++;
+            keys[outcome] ^= search.keys[layout];
+            openCells[outcome] += (search.occupied[layout] & ~next).count();
+        }
+    }
+
+    // Every open ship cell needs a shot, so this is a lower bound
+    double layouts = double(end - begin);
+    double value = 1;
+    for (int outcome = 0; outcome < EndgameSearch::OUTCOMES; outcome++) {
+        value += openCells[outcome] / layouts;
+    }
+    if (value > ceiling) {
+        return UNSOLVED;
+    }
+
+    size_t base = stack.size();
+    array<size_t, EndgameSearch::OUTCOMES> starts{};
+    size_t size = 0;
+    for (int outcome = 0; outcome < EndgameSearch::OUTCOMES; outcome++) {
+        starts[outcome] = base + size;
+        size += sizes[outcome];
+    }
+    stack.resize(base + size);
+    array<size_t, EndgameSearch::OUTCOMES> fill = starts;
+    for (size_t position = begin; position < end; position++) {
+        int layout = stack[position];
+        int outcome = search.outcome(layout, cell, next);
+        if (outcome != EndgameSearch::FINISHED) {
+            stack[fill[outcome]++] = layout;
+        }
+    }
+
+    uint64_t nextKey = shotKey ^ ZOBRIST.cellKey(cell, 1);
+    for (int outcome = 0; outcome < EndgameSearch::OUTCOMES
+            && value <= ceiling; outcome++) {
+        if (sizes[outcome] == 0) {
+            continue;
+        }
+        double child = stateValue(search, worker, starts[outcome],
+                starts[outcome] + sizes[outcome], next, nextKey,
+                keys[outcome]);
+        value += (child - openCells[outcome] / double(sizes[outcome]))
+                * (sizes[outcome] / layouts);
+    }
+    stack.resize(base);
+    return value <= ceiling ? value : UNSOLVED;
+}
+
+/**
+ * @brief Computes the expected number of shots of the best policy.
+ *
+ * @details Targets are tried most likely ship first; once the lower bound of
+ *          a target reaches the best value found, the others are skipped.
+ *
+ * @param search The layouts and limits.
+ * @param worker The calling worker.
+ * @param begin First position of the state's layouts in the worker's stack.
+ * @param end Position after its last layout.
+ * @param shot The cells shot so far.
+ * @param shotKey The key of the cells shot so far.
+ * @param layoutsKey The XOR of the keys of the state's layouts.
+ * @return The expected number of shots to sink all ships; meaningless if
+ *         the search was aborted.
+ */
+static double stateValue(EndgameSearch& search, EndgameWorker& worker,
+        size_t begin, size_t end, Bitboard shot, uint64_t shotKey,
+        uint64_t layoutsKey) {
+    if (search.charge(worker)) {
+        return 0;
+    }
+    EndgameTargets targets;
+    rankTargets(search, worker.stack, begin, end, shot, targets);
+    if (targets.settled) {
+        return targets.common.count();
+    }
+
+    uint64_t key = Zobrist::mix(layoutsKey) ^ shotKey;
+    double best;
+    if (search.memo.find(key, best)) {
+        return best;
+    }
+
+    best = UNSOLVED;
+    double layouts = double(end - begin);
+    double lower = 1 + targets.openCells / layouts;
+    for (int target = 0; target < targets.size; target++) {
+        int cell = targets.cells[target];
+        if (lower - targets.counts[cell] / layouts >= best - EPSILON) {
+            break;
+        }
+        best = min(best, shotValue(search, worker, begin, end, shot, shotKey,
+                cell, best - EPSILON));
+    }
+    if (search.aborted.load(memory_order_relaxed) == false) {
+        search.memo.store(key, best);
+    }
+    return best;
+}
+
+/**
+ * @brief Builds the constraints on the ships that are still afloat.
+ *
+ * @details Sunken ships are left out, so their cells count as misses.
+ *
+ * @param grid The results of the own shots so far.
+ * @return The constraints for the remaining fleet.
+ */
+static ShotKnowledge remainingKnowledge(const OpponentGrid& grid) {
+    Bitboard sunk = grid.getStateMask(OpponentGrid::SUNK);
+    return ShotKnowledge{grid.getWaterMask() | sunk,
+            grid.getStateMask(OpponentGrid::HIT), Bitboard{}};
+}
+
+/**
+ * @brief Constructor to create a solver for a rule set.
+ *
+ * @param rules The rules of the opponent's grid.
+ * @param memoSlots Number of states the memo can hold.
+ * @throws std::invalid_argument if the rule set is not valid.
+ */
+EndgameSolver::EndgameSolver(const RuleSet& rules, size_t memoSlots)
+        : rules{rules}, threshold{DEFAULT_THRESHOLD},
+          maxLayouts{DEFAULT_MAX_LAYOUTS}, memo{memoSlots} {
+    if (rules.isValid() == false) {
+        throw invalid_argument("EndgameSolver: rule set is not valid");
+    }
+    table = make_shared<const PlacementTable>(rules);
+}
+
+/**
+ * @brief Sets the number of uncertain cells up to which solve() searches.
+ *
+ * @param cells Number of open cells that may hold a ship, at least 0.
+ */
+void EndgameSolver::setThreshold(int cells) {
+    threshold = max(0, cells);
+}
+
+/**
+ * @brief Getter method to retrieve the uncertainty threshold.
+ *
+ * @return The most uncertain cells solve() searches.
+ */
+int EndgameSolver::getThreshold() const {
+    return threshold;
+}
+
+/**
+ * @brief Sets the number of consistent layouts up to which solve()
+ *        searches.
+ *
+ * @param layouts Number of layouts, at least 1.
+ */
+void EndgameSolver::setMaxLayouts(long layouts) {
+    maxLayouts = max(1L, layouts);
+}
+
+/**
+ * @brief Getter method to retrieve the layout limit.
+ *
+ * @return The most consistent layouts solve() searches.
+ */
+long EndgameSolver::getMaxLayouts() const {
+    return maxLayouts;
+}
+
+/**
+ * @brief Sets the limits of one search.
+ *
+ * @param budget The node and time limit.
+ */
+void EndgameSolver::setBudget(const EndgameBudget& budget) {
+    this->budget = budget;
+}
+
+/**
+ * @brief Counts the open cells that may still hold a ship.
+ *
+ * @param grid The results of the own shots so far.
+ * @return The number of uncertain cells.
+ */
+int EndgameSolver::uncertainty(const OpponentGrid& grid) const {
+    ShotKnowledge knowledge = remainingKnowledge(grid);
+    RuleSet::Quota remaining = grid.getRemainingShips();
+    Bitboard covered;
+    for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+            length++) {
+        if (remaining[length] == 0) {
+            continue;
+        }
+        for (int index = table->begin(length); index < table->end(length);
+                index++) {
+            const Placement& placement = (*table)[index];
+            if (knowledge.allows(placement)) {
+                covered |= placement.occupied;
+            }
+        }
+    }
+    return (covered & ~grid.getHitMask()).count();
+}
+
+/**
+ * @brief Searches the consistent layouts for the best shot.
+ *
+ * @param grid The results of the own shots so far.
+ * @param pool The workers to use; nullptr for the calling thread.
+ * @return The best shot and its value, or why there is none.
+ */
+EndgameSolution EndgameSolver::search(const OpponentGrid& grid,
+        ThreadPool* pool) {
+    EndgameSolution solution;
+    solution.uncertainCells = uncertainty(grid);
+    if (solution.uncertainCells > threshold) {
+        return solution;
+    }
+
+    // List the layouts of the ships still afloat
+    RuleSet remaining{rules.getRows(), rules.getColumns(),
+            grid.getRemainingShips(), rules.mayShipsTouch()};
+    FleetEnumerator enumerator{remaining};
+    enumerator.setKnowledge(remainingKnowledge(grid));
+    uint64_t layouts = enumerator.count();
+    if (layouts > uint64_t(maxLayouts)) {
+        solution.status = EndgameSolution::TOO_MANY_LAYOUTS;
+        solution.layouts = long(layouts);
+        return solution;
+    }
+    EndgameSearch search{memo, budget};
+    search.fleetSize = remaining.getFleetSize();
+    const PlacementTable& placements = enumerator.getTable();
+    vector<Bitboard> ships;
+    enumerator.enumerate([&](const FleetEnumerator::Layout& layout,
+            unsigned) {
+        ships.clear();
+        for (int index : layout) {
+            ships.push_back(placements[index].occupied);
+        }
+        search.add(ships);
+    });
+    solution.layouts = long(search.occupied.size());
+    if (search.occupied.empty()) {
+        solution.status = EndgameSolution::INCONSISTENT;
+        return solution;
+    }
+
+    unsigned workerCount = pool != nullptr ? pool->size() : 1;
+    vector<EndgameWorker> workers(workerCount);
+    size_t size = search.occupied.size();
+    uint64_t layoutsKey = 0;
+    for (EndgameWorker& worker : workers) {
+        worker.stack.resize(size);
+        for (size_t layout = 0; layout < size; layout++) {
+            worker.stack[layout] = int(layout);
+        }
+    }
+    for (uint64_t key : search.keys) {
+        layoutsKey ^= key;
+    }
+
+    Bitboard shot = grid.getHitMask();
+    EndgameTargets targets;
+    rankTargets(search, workers[0].stack, 0, size, shot, targets);
+    solution.status = EndgameSolution::SOLVED;
+    if (targets.settled) {
+        solution.expectedShots = targets.common.count();
+        if (targets.common.any()) {
+            solution.target = CellIndex{static_cast<uint16_t>(
+                    targets.common.first())};
+        }
+        return solution;
+    }
+
+    // Each target at the root is a task; all share the best value so far
+    uint64_t shotKey = ZOBRIST.cellsKey(shot, 1);
+    double lower = 1 + targets.openCells / double(size);
+    vector<double> values(targets.size, UNSOLVED);
+    atomic<double> best{UNSOLVED};
+    auto evaluate = [&](size_t task, unsigned workerNumber) {
+        int cell = targets.cells[task];
+        double current = best.load(memory_order_relaxed);
+        if (lower - targets.counts[cell] / double(size) > current + EPSILON) {
+            return;
+        }
+        values[task] = shotValue(search, workers[workerNumber], 0, size,
+                shot, shotKey, cell, current + EPSILON);
+        while (values[task] < current && !best.compare_exchange_weak(
+                current, values[task], memory_order_relaxed)) {
+        }
+    };
+    if (pool != nullptr) {
+        pool->run(size_t(targets.size), evaluate);
+    } else {
+        for (int task = 0; task < targets.size; task++) {
+            evaluate(size_t(task), 0);
+        }
+    }
+
+    solution.nodes = search.nodes.load(memory_order_relaxed);
+    for (const EndgameWorker& worker : workers) {
+        solution.nodes += worker.pending;
+    }
+    if (search.aborted.load(memory_order_relaxed)) {
+        solution.status = EndgameSolution::OUT_OF_BUDGET;
+        return solution;
+    }
+    int chosen = int(min_element(values.begin(), values.end())
+            - values.begin());
+    solution.target = CellIndex{static_cast<uint16_t>(
+            targets.cells[chosen])};
+    solution.expectedShots = values[chosen];
+    memo.store(Zobrist::mix(layoutsKey) ^ shotKey, values[chosen]);
+    return solution;
+}
+
+/**
+ * @brief Finds the best shot on the calling thread.
+ *
+ * @param grid The results of the own shots so far.
+ * @return The best shot and its value, or why there is none.
+ */
+EndgameSolution EndgameSolver::solve(const OpponentGrid& grid) {
+    return search(grid, nullptr);
+}
+
+/**
+ * @brief Finds the best shot on all workers of a pool.
+ *
+ * @param grid The results of the own shots so far.
+ * @param pool The workers to use.
+ * @return The same solution as solve(grid), unless the budget runs out.
+ */
+EndgameSolution EndgameSolver::solve(const OpponentGrid& grid,
+        ThreadPool& pool) {
+    return search(grid, &pool);
+}
+
+/**
+ * @brief Forgets the values of all searched states.
+ */
+void EndgameSolver::clearMemo() {
+    memo.clear();
+}
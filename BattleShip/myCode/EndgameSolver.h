@@ -0,0 +1,203 @@
+/**
+ * @file EndgameSolver.h
+ * @brief Header file for the EndgameSolver class, which finds the shot that
+ *        minimizes the expected number of shots to sink the rest of the
+ *        opponent's fleet.
+ *
+ * @details Heat maps choose the cell most likely to hold a ship, which is not
+ *          always the cell that finishes the game fastest. Once few cells are
+ *          uncertain, the solver lists every layout of the ships still
+ *          afloat that is consistent with the grid (see FleetEnumerator) and
+ *          searches the game tree: a shot splits the layouts by the reported
+ *          impact, and the value of a state is the smallest expected number
+ *          of shots over all targets. All consistent layouts are taken to be
+ *          equally likely.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef ENDGAMESOLVER_H_
+#define ENDGAMESOLVER_H_
+
+#include "OpponentGrid.h"
+#include "PlacementTable.h"
+#include "ThreadPool.h"
+#include "TranspositionTable.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @struct EndgameBudget
+ * @brief When EndgameSolver::solve() gives up.
+ *
+ * @details The search stops at whichever limit is reached first. Limits are
+ *          checked every EndgameSolver::CHECK_NODES nodes of each worker.
+ */
+struct EndgameBudget {
+    long maxNodes = 500000; ///< Number of search nodes at most.
+    std::chrono::milliseconds maxTime{0}; ///< Time limit; 0 for none.
+};
+
+/**
+ * @struct EndgameSolution
+ * @brief Result of EndgameSolver::solve().
+ */
+struct EndgameSolution {
+    /**
+     * @enum Status
+     * @brief Whether the search found the best shot.
+     */
+    enum Status {
+        SOLVED,           /**< target is an optimal shot. */
+        TOO_UNCERTAIN,    /**< More uncertain cells than the threshold. */
+        TOO_MANY_LAYOUTS, /**< More consistent layouts than allowed. */
+        OUT_OF_BUDGET,    /**< The budget ran out during the search. */
+        INCONSISTENT      /**< No layout fits the grid. */
+    };
+
+    Status status = TOO_UNCERTAIN; ///< Whether target is valid.
+    /// The shot to fire; off the grid if not solved or no ship is left.
+    CellIndex target{static_cast<std::uint16_t>(Bitboard::CAPACITY)};
+    double expectedShots = 0; ///< Expected shots to sink the remaining
+                              ///< ships, including target.
+    int uncertainCells = 0;   ///< Open cells that may hold a ship.
+    long layouts = 0; ///< Consistent layouts of the remaining ships.
+    long nodes = 0;   ///< Search nodes visited.
+};
+
+/**
+ * @class EndgameSolver
+ * @brief Expectimax search over the consistent layouts of the remaining
+ *        ships.
+ *
+ * @details solve() only searches if at most getThreshold() open cells may
+ *          still hold a ship and at most getMaxLayouts() layouts are
+ *          consistent; otherwise, or if the budget runs out, the status tells
+ *          the caller to fall back to a heuristic.
+ *
+ *          Values of searched states are kept in a TranspositionTable. The
+ *          key of a state is made of the cells shot and the set of layouts
+ *          still consistent, so states reached by different shot orders, and
+ *          states met again in later moves of the same game, share their
+ *          values. With a ThreadPool, the targets at the root are searched
+ *          as separate tasks that share the memo and the best value found.
+ *          The result does not depend on the number of threads.
+ *
+ *          A solver is not thread safe apart from the workers of its own
+ *          solve(); use one per thread, e.g. per tournament worker.
+ */
+class EndgameSolver {
+public:
+    static constexpr int DEFAULT_THRESHOLD = 12; ///< Uncertain cells up to
+                                                 ///< which solve() searches.
+    static constexpr long DEFAULT_MAX_LAYOUTS = 100; ///< Layouts at most.
+    static constexpr std::size_t DEFAULT_MEMO_SLOTS = 1 << 18; ///< Memo size.
+    static constexpr long CHECK_NODES = 256; ///< Nodes between budget checks.
+
+private:
+    RuleSet rules; ///< The rules of the opponent's grid.
+    std::shared_ptr<const PlacementTable> table; ///< Placements of the rules.
+    int threshold;   ///< Uncertain cells at most.
+    long maxLayouts; ///< Consistent layouts at most.
+    EndgameBudget budget; ///< Limits of one search.
+    TranspositionTable<double> memo; ///< Expected shots of searched states.
+
+    /**
+     * @brief Searches the consistent layouts for the best shot.
+     * @param grid The results of the own shots so far.
+     * @param pool The workers to use; nullptr for the calling thread.
+     * @return The best shot and its value, or why there is none.
+     */
+    EndgameSolution search(const OpponentGrid& grid, ThreadPool* pool);
+
+public:
+    /**
+     * @brief Constructor to create a solver for a rule set.
+     *
+     * @param rules The rules of the opponent's grid.
+     * @param memoSlots Number of states the memo can hold.
+     * @throws std::invalid_argument if the rule set is not valid.
+     */
+    explicit EndgameSolver(const RuleSet& rules = STANDARD_RULES,
+            std::size_t memoSlots = DEFAULT_MEMO_SLOTS);
+
+    /**
+     * @brief Sets the number of uncertain cells up to which solve()
+     *        searches.
+     *
+     * @param cells Number of open cells that may hold a ship, at least 0.
+     */
+    void setThreshold(int cells);
+
+    /**
+     * @brief Getter method to retrieve the uncertainty threshold.
+     *
+     * @return The most uncertain cells solve() searches.
+     */
+    int getThreshold() const;
+
+    /**
+     * @brief Sets the number of consistent layouts up to which solve()
+     *        searches.
+     *
+     * @param layouts Number of layouts, at least 1.
+     */
+    void setMaxLayouts(long layouts);
+
+    /**
+     * @brief Getter method to retrieve the layout limit.
+     *
+     * @return The most consistent layouts solve() searches.
+     */
+    long getMaxLayouts() const;
+
+    /**
+     * @brief Sets the limits of one search.
+     *
+     * @param budget The node and time limit.
+     */
+    void setBudget(const EndgameBudget& budget);
+
+    /**
+     * @brief Counts the open cells that may still hold a ship.
+     *
+     * @details A cell is uncertain if it was not shot, is not known to be
+     *          water and a remaining ship has a consistent placement on it.
+     *
+     * @param grid The results of the own shots so far.
+     * @return The number of uncertain cells.
+     */
+    int uncertainty(const OpponentGrid& grid) const;
+
+    /**
+     * @brief Finds the best shot on the calling thread.
+     *
+     * @param grid The results of the own shots so far; same rules as the
+     *        solver.
+     * @return The best shot and its value, or why there is none.
+     */
+    EndgameSolution solve(const OpponentGrid& grid);
+
+    /**
+     * @brief Finds the best shot on all workers of a pool.
+     *
+     * @param grid The results of the own shots so far; same rules as the
+     *        solver.
+     * @param pool The workers to use.
+     * @return The same solution as solve(grid), unless the budget runs out.
+     */
+    EndgameSolution solve(const OpponentGrid& grid, ThreadPool& pool);
+
+    /**
+     * @brief Forgets the values of all searched states.
+     */
+    void clearMemo();
+};
+
+#endif /* ENDGAMESOLVER_H_ */
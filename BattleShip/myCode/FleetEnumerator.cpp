@@ -0,0 +1,487 @@
+/**
+ * @file FleetEnumerator.cpp
+ * @brief Implementation file for the FleetEnumerator class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "FleetEnumerator.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/**
+ * @brief Constructor to search the fleet of a rule set.
+ *
+ * @details The search starts with a ship whose length occurs only once, if
+ *          there is one, so that count() can fold it by symmetry. The other
+ *          ships follow from the largest to the smallest, which keeps the
+ *          search tree narrow near the root.
+ *
+ * @param rules The board, fleet and touching rule.
+ * @throws std::invalid_argument if the rule set is not valid.
+ */
+FleetEnumerator::FleetEnumerator(const RuleSet& rules) : rules{rules},
+        candidates(Ship::MAX_LENGTH + 1) {
+    if (rules.isValid() == false) {
+        throw invalid_argument("FleetEnumerator: rule set is not valid");
+    }
+    table = make_shared<const PlacementTable>(rules);
+
+    int uniqueLength = 0;
+    for (int length = Ship::MAX_LENGTH; length >= Ship::MIN_LENGTH;
+            length--) {
+        if (rules.getQuota(length) == 1 && uniqueLength == 0) {
+            uniqueLength = length;
+            slotLengths.push_back(length);
+        }
+    }
+    for (int length = Ship::MAX_LENGTH; length >= Ship::MIN_LENGTH;
+            length--) {
+        if (length != uniqueLength) {
+            slotLengths.insert(slotLengths.end(), rules.getQuota(length),
+                    length);
+        }
+    }
+
+    remainingCells.assign(slotLengths.size() + 1, 0);
+    for (int slot = static_cast<int>(slotLengths.size()) - 1; slot >= 0;
+            slot--) {
+        remainingCells[slot] = remainingCells[slot + 1] + slotLengths[slot];
+    }
+    remainingShips.assign(slotLengths.size() + 1,
+            array<int, Ship::MAX_LENGTH + 1>{});
+    for (int slot = static_cast<int>(slotLengths.size()) - 1; slot >= 0;
+            slot--) {
+        remainingShips[slot] = remainingShips[slot + 1];
+        remainingShips[slot][slotLengths[slot]]++;
+    }
+    filterCandidates();
+}
+
+/**
+ * @brief Restricts the search to layouts consistent with a shot record.
+ *
+ * @param knowledge The constraints; an empty record removes them.
+ */
+void FleetEnumerator::setKnowledge(const ShotKnowledge& knowledge) {
+    this->knowledge = knowledge;
+    filterCandidates();
+}
+
+/**
+ * @brief Getter method to retrieve the placements that layouts refer to.
+ *
+ * @return A constant reference to the placement table of the rules.
+ */
+const PlacementTable& FleetEnumerator::getTable() const {
+    return *table;
+}
+
+/**
+ * @brief Refilters the candidates after a change of knowledge.
+ */
+void FleetEnumerator::filterCandidates() {
+    for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+            length++) {
+        candidates[length].clear();
+        for (int index = table->begin(length); index < table->end(length);
+                index++) {
+            if (knowledge.allows((*table)[index])) {
+                candidates[length].push_back(index);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks whether the symmetry of the board may be used.
+ *
+ * @return true if there is no knowledge and the first ship is unique.
+ */
+bool FleetEnumerator::useSymmetry() const {
+    return knowledge.isEmpty() && slotLengths.empty() == false
+            && rules.getQuota(slotLengths[0]) == 1;
+}
+
+/**
+ * @brief Maps a placement to its image under a symmetry of the board.
+ *
+ * @param index The placement.
+ * @param symmetry The symmetry: bit 0 mirrors the rows, bit 1 the columns
+ *        and bit 2 swaps rows and columns (square boards only).
+ * @return The index of the image.
+ */
+int FleetEnumerator::image(int index, int symmetry) const {
+    const Placement& placement = (*table)[index];
+    int rows = table->getRows();
+    int columns = table->getColumns();
+    int firstRow = placement.rowIndex;
+    int firstColumn = placement.columnIndex;
+    int lastRow = placement.vertical ? firstRow + placement.length - 1
+            : firstRow;
+    int lastColumn = placement.vertical ? firstColumn
+            : firstColumn + placement.length - 1;
+
+    if (symmetry & 1) {
+        firstRow = rows - 1 - firstRow;
+        lastRow = rows - 1 - lastRow;
+    }
+    if (symmetry & 2) {
+        firstColumn = columns - 1 - firstColumn;
+        lastColumn = columns - 1 - lastColumn;
+    }
+    if (symmetry & 4) {
+        swap(firstRow, firstColumn);
+        swap(lastRow, lastColumn);
+    }
+    return table->indexOf(min(firstRow, lastRow),
+            min(firstColumn, lastColumn), placement.length,
+            firstColumn == lastColumn);
+}
+
+/**
+ * @brief Adds the ships of one slot to a list of branches.
+ *
+ * @details With symmetry, a placement is only kept if it has the smallest
+ *          index of its symmetry class, and it stands for the whole class.
+ *
+ * @param branch The partial layout to extend.
+ * @param slot The slot to fill.
+ * @param symmetric True to fold this ship by the board symmetry.
+ * @param branches Receives the extended branches.
+ */
+void FleetEnumerator::extend(const Branch& branch, int slot, bool symmetric,
+        vector<Branch>& branches) const {
+    const vector<int>& list = candidates[slotLengths[slot]];
+    int symmetries = table->getRows() == table->getColumns() ? 8 : 4;
+    for (int position = firstCandidate(slot, branch.previous);
+            position < static_cast<int>(list.size()); position++) {
+        int index = list[position];
+        const Placement& placement = (*table)[index];
+        if (placement.occupied.intersects(branch.blocked)) {
+            continue;
+        }
+
+        uint64_t weight = branch.weight;
+        if (symmetric) {
+            int images[8];
+            bool representative = true;
+            for (int symmetry = 0; symmetry < symmetries; symmetry++) {
+                images[symmetry] = image(index, symmetry);
+                representative = representative && images[symmetry] >= index;
+            }
+            if (representative == false) {
+                continue;
+            }
+            sort(images, images + symmetries);
+            weight *= unique(images, images + symmetries) - images;
+        }
+
+        Branch next{branch.blocked | placement.blocked,
+            branch.occupied | placement.occupied, position, weight,
+            branch.layout};
+        next.layout.push_back(index);
+        branches.push_back(move(next));
+    }
+}
+
+/**
+ * @brief Splits the search into branches of SPLIT_DEPTH ships.
+ *
+ * @param symmetric True to fold the first ship by the board symmetry.
+ * @return The branches.
+ */
+vector<FleetEnumerator::Branch> FleetEnumerator::split(bool symmetric) const {
+    vector<Branch> branches{Branch{Bitboard{}, Bitboard{}, -1, 1, Layout{}}};
+    int depth = min(SPLIT_DEPTH, static_cast<int>(slotLengths.size()));
+    for (int slot = 0; slot < depth; slot++) {
+        vector<Branch> extended;
+        for (const Branch& branch : branches) {
+            extend(branch, slot, symmetric && slot == 0, extended);
+        }
+        branches = move(extended);
+    }
+    return branches;
+}
+
+/**
+ * @brief Returns the buffer size one Frontier needs.
+ *
+ * @return Number of candidates of all lengths.
+ */
+int FleetEnumerator::frontierSize() const {
+    int size = 0;
+    for (const vector<int>& list : candidates) {
+        size += static_cast<int>(list.size());
+    }
+    return size;
+}
+
+/**
+ * @brief Sets up the frontier of a branch.
+ *
+ * @param branch The partial layout.
+ * @param buffer Storage of frontierSize() entries for the lists.
+ * @param frontier Receives the legal candidates.
+ * @return false if a remaining ship has too few candidates.
+ */
+bool FleetEnumerator::start(const Branch& branch, int* buffer,
+        Frontier& frontier) const {
+    int slot = static_cast<int>(branch.layout.size());
+    for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+            length++) {
+        frontier.lists[length] = buffer;
+        frontier.sizes[length] = 0;
+        if (remainingShips[slot][length] == 0) {
+            continue;
+        }
+        const vector<int>& list = candidates[length];
+        int first = slot > 0 && slotLengths[slot - 1] == length
+                ? branch.previous + 1 : 0;
+        for (int position = first; position < static_cast<int>(list.size());
+                position++) {
+            if (!(*table)[list[position]].occupied.intersects(branch.blocked)) {
+                buffer[frontier.sizes[length]++] = position;
+            }
+        }
+        if (frontier.sizes[length] < remainingShips[slot][length]) {
+            return false;
+        }
+        buffer += frontier.sizes[length];
+    }
+    return true;
+}
+
+/**
+ * @brief Narrows a frontier to the candidates left after placing a ship.
+ *
+ * @details Ships of the placed length only keep the candidates after it, so
+ *          equal ships stay in increasing order.
+ *
+ * @param parent The frontier before placing the ship.
+ * @param slot The next slot to fill.
+ * @param position Position of the placed ship in its parent list.
+ * @param blocked Blocked cells including the placed ship.
+ * @param buffer Storage of frontierSize() entries for the lists.
+ * @param child Receives the legal candidates.
+ * @return false if a remaining ship has too few candidates.
+ */
+bool FleetEnumerator::narrow(const Frontier& parent, int slot, int position,
+        Bitboard blocked, int* buffer, Frontier& child) const {
+    int placedLength = slotLengths[slot - 1];
+    for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+            length++) {
+        child.lists[length] = buffer;
+        child.sizes[length] = 0;
+        if (remainingShips[slot][length] == 0) {
+            continue;
+        }
+        const vector<int>& list = candidates[length];
+        for (int entry = length == placedLength ? position + 1 : 0;
+                entry < parent.sizes[length]; entry++) {
+            int candidate = parent.lists[length][entry];
+            if (!(*table)[list[candidate]].occupied.intersects(blocked)) {
+                buffer[child.sizes[length]++] = candidate;
+            }
+        }
+        if (child.sizes[length] < remainingShips[slot][length]) {
+            return false;
+        }
+        buffer += child.sizes[length];
+    }
+    return true;
+}
+
+/**
+ * @brief Counts the completions of a partial layout.
+ *
+ * @details The last ship is not placed; its legal candidates are counted.
+ *
+ * @param slot The next slot to fill.
+ * @param blocked Blocked cells of the placed ships.
+ * @param occupied Cells of the placed ships.
+ * @param frontier The legal candidates of the remaining ships.
+ * @param buffer Storage for the frontiers of the deeper slots.
+ * @return Number of consistent completions.
+ */
+uint64_t FleetEnumerator::countFrom(int slot, Bitboard blocked,
+        Bitboard occupied, const Frontier& frontier, int* buffer) const {
+    int slots = static_cast<int>(slotLengths.size());
+    if (slot == slots) {
+        return knowledge.covers(occupied) ? 1 : 0;
+    }
+
+    // The remaining ships must be able to cover the remaining hits
+    Bitboard uncovered = knowledge.getHits() & ~occupied;
+    if (uncovered.count() > remainingCells[slot]) {
+        return 0;
+    }
+
+    int length = slotLengths[slot];
+    const int* list = frontier.lists[length];
+    int size = frontier.sizes[length];
+    if (slot == slots - 1 && uncovered.none()) {
+        return size;
+    }
+
+    uint64_t total = 0;
+    Frontier child;
+    for (int entry = 0; entry < size; entry++) {
+        const Placement& placement = (*table)[candidates[length][list[entry]]];
+        if (slot == slots - 1) {
+            total += uncovered.isSubsetOf(placement.occupied) ? 1 : 0;
+            continue;
+        }
+        Bitboard nextBlocked = blocked | placement.blocked;
+        if (narrow(frontier, slot + 1, entry, nextBlocked, buffer, child)) {
+            total += countFrom(slot + 1, nextBlocked,
+                    occupied | placement.occupied, child,
+                    buffer + frontierSize());
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Visits the completions of a partial layout.
+ *
+ * @param slot The next slot to fill.
+ * @param blocked Blocked cells of the placed ships.
+ * @param occupied Cells of the placed ships.
+ * @param frontier The legal candidates of the remaining ships.
+ * @param buffer Storage for the frontiers of the deeper slots.
+ * @param layout The placed ships; restored before returning.
+ * @param visitor Receives each complete layout.
+ * @param worker Number of the running worker.
+ */
+void FleetEnumerator::visitFrom(int slot, Bitboard blocked, Bitboard occupied,
+        const Frontier& frontier, int* buffer, Layout& layout,
+        const Visitor& visitor, unsigned worker) const {
+    if (slot == static_cast<int>(slotLengths.size())) {
+        if (knowledge.covers(occupied)) {
+            visitor(layout, worker);
+        }
+        return;
+    }
+    if ((knowledge.getHits() & ~occupied).count() > remainingCells[slot]) {
+        return;
+    }
+
+    int length = slotLengths[slot];
+    Frontier child;
+    for (int entry = 0; entry < frontier.sizes[length]; entry++) {
+        int index = candidates[length][frontier.lists[length][entry]];
+        const Placement& placement = (*table)[index];
+        Bitboard nextBlocked = blocked | placement.blocked;
+        if (narrow(frontier, slot + 1, entry, nextBlocked, buffer, child)) {
+            layout.push_back(index);
+            visitFrom(slot + 1, nextBlocked, occupied | placement.occupied,
+                    child, buffer + frontierSize(), layout, visitor, worker);
+            layout.pop_back();
+        }
+    }
+}
+
+/**
+ * @brief Counts the completions of a branch.
+ *
+ * @param branch The partial layout.
+ * @return Number of consistent completions, not weighted.
+ */
+uint64_t FleetEnumerator::countBranch(const Branch& branch) const {
+    int slot = static_cast<int>(branch.layout.size());
+    vector<int> buffer((slotLengths.size() - slot + 1) * frontierSize());
+    Frontier frontier;
+    if (start(branch, buffer.data(), frontier) == false) {
+        return 0;
+    }
+    return countFrom(slot, branch.blocked, branch.occupied, frontier,
+            buffer.data() + frontierSize());
+}
+
+/**
+ * @brief Visits the completions of a branch.
+ *
+ * @param branch The partial layout.
+ * @param visitor Receives each complete layout.
+ * @param worker Number of the running worker.
+ */
+void FleetEnumerator::visitBranch(const Branch& branch,
+        const Visitor& visitor, unsigned worker) const {
+    int slot = static_cast<int>(branch.layout.size());
+    vector<int> buffer((slotLengths.size() - slot + 1) * frontierSize());
+    Frontier frontier;
+    if (start(branch, buffer.data(), frontier) == false) {
+        return;
+    }
+    Layout layout = branch.layout;
+    visitFrom(slot, branch.blocked, branch.occupied, frontier,
+            buffer.data() + frontierSize(), layout, visitor, worker);
+}
+
+/**
+ * @brief Counts the consistent layouts on the calling thread.
+ *
+ * @return The number of layouts.
+ */
+uint64_t FleetEnumerator::count() const {
+    uint64_t total = 0;
+    for (const Branch& branch : split(useSymmetry())) {
+        total += branch.weight * countBranch(branch);
+    }
+    return total;
+}
+
+/**
+ * @brief Counts the consistent layouts on all workers of a pool.
+ *
+ * @param pool The workers to use.
+ * @return The number of layouts.
+ */
+uint64_t FleetEnumerator::count(ThreadPool& pool) const {
+    vector<Branch> branches = split(useSymmetry());
+    vector<uint64_t> totals(pool.size(), 0);
+    pool.run(branches.size(), [&](size_t task, unsigned worker) {
+        totals[worker] += branches[task].weight
+                * countBranch(branches[task]);
+    });
+
+    uint64_t total = 0;
+    for (uint64_t workerTotal : totals) {
+        total += workerTotal;
+    }
+    return total;
+}
+
+/**
+ * @brief Visits every consistent layout on the calling thread.
+ *
+ * @param visitor Receives each layout; worker is always 0.
+ */
+void FleetEnumerator::enumerate(const Visitor& visitor) const {
+    for (const Branch& branch : split(false)) {
+        visitBranch(branch, visitor, 0);
+    }
+}
+
+/**
+ * @brief Visits every consistent layout on all workers of a pool.
+ *
+ * @param pool The workers to use.
+ * @param visitor Receives each layout; called concurrently from different
+ *        workers.
+ */
+void FleetEnumerator::enumerate(ThreadPool& pool, const Visitor& visitor)
+        const {
+    vector<Branch> branches = split(false);
+    pool.run(branches.size(), [&](size_t task, unsigned worker) {
+        visitBranch(branches[task], visitor, worker);
+    });
+}
@@ -0,0 +1,264 @@
+/**
+ * @file FleetEnumerator.h
+ * @brief Header file for the FleetEnumerator class, which counts or lists
+ *        every legal layout of a fleet.
+ *
+ * @details Exact layout counts are the ground truth for the probabilistic
+ *          targeting code. The search is a depth-first search over the
+ *          PlacementTable that is split into independent branches and run
+ *          on a ThreadPool.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef FLEETENUMERATOR_H_
+#define FLEETENUMERATOR_H_
+
+#include "PlacementTable.h"
+#include "ShotKnowledge.h"
+#include "ThreadPool.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @class FleetEnumerator
+ * @brief Exhaustive search over the layouts of a rule set's fleet.
+ *
+ * @details Ships of equal length are interchangeable, so each layout is
+ *          found once: they are placed in increasing placement order.
+ *          Without shot knowledge, count() also uses the symmetry of the
+ *          board (8-fold for square, 4-fold for other boards) if the fleet
+ *          has a length with a single ship: only one placement of each
+ *          symmetry class of that ship is searched and its count is
+ *          multiplied by the size of the class.
+ */
+class FleetEnumerator {
+public:
+    /// A layout as indices into getTable(), in the order of the search.
+    using Layout = std::vector<int>;
+
+    /**
+     * @brief Receives each layout found by enumerate() together with the
+     *        number of the worker that found it.
+     */
+    using Visitor = std::function<void(const Layout& layout,
+            unsigned worker)>;
+
+    static constexpr int SPLIT_DEPTH = 2; ///< Ships placed before the search
+                                          ///< is split into tasks.
+
+private:
+    /**
+     * @struct Branch
+     * @brief A partial layout that is searched as one task.
+     */
+    struct Branch {
+        Bitboard blocked;  ///< Blocked cells of the placed ships.
+        Bitboard occupied; ///< Cells of the placed ships.
+        int previous;      ///< Candidate position of the last ship.
+        std::uint64_t weight; ///< Layouts this branch stands for.
+        Layout layout;     ///< The placed ships.
+    };
+
+    RuleSet rules; ///< The rules of the searched fleet.
+    std::shared_ptr<const PlacementTable> table; ///< Placements of the rules.
+    ShotKnowledge knowledge; ///< Constraints from a shot record.
+    std::vector<int> slotLengths; ///< Length of each ship in search order.
+    std::vector<int> remainingCells; ///< Cells of the ships from each slot on.
+    /// Number of ships of each length from each slot on.
+    std::vector<std::array<int, Ship::MAX_LENGTH + 1>> remainingShips;
+    /// Placements allowed by the knowledge, for each length.
+    std::vector<std::vector<int>> candidates;
+
+    /**
+     * @brief Refilters the candidates after a change of knowledge.
+     */
+    void filterCandidates();
+
+    /**
+     * @brief Checks whether the symmetry of the board may be used.
+     * @return true if there is no knowledge and the first ship is unique.
+     */
+    bool useSymmetry() const;
+
+    /**
+     * @brief Maps a placement to its image under a symmetry of the board.
+     * @param index The placement.
+     * @param symmetry The symmetry: bit 0 mirrors the rows, bit 1 the
+     *        columns and bit 2 swaps rows and columns (square boards only).
+     * @return The index of the image.
+     */
+    int image(int index, int symmetry) const;
+
+    /**
+     * @brief Splits the search into branches of SPLIT_DEPTH ships.
+     * @param symmetric True to fold the first ship by the board symmetry.
+     * @return The branches.
+     */
+    std::vector<Branch> split(bool symmetric) const;
+
+    /**
+     * @brief Adds the ships of one slot to a list of branches.
+     * @param branch The partial layout to extend.
+     * @param slot The slot to fill.
+     * @param symmetric True to fold this ship by the board symmetry.
+     * @param branches Receives the extended branches.
+     */
+    void extend(const Branch& branch, int slot, bool symmetric,
+            std::vector<Branch>& branches) const;
+
+    /**
+     * @struct Frontier
+     * @brief The candidates of each length that are still legal at one
+     *        depth of the search, as positions in candidates.
+     */
+    struct Frontier {
+        std::array<int*, Ship::MAX_LENGTH + 1> lists; ///< Legal positions.
+        std::array<int, Ship::MAX_LENGTH + 1> sizes;  ///< Length of lists.
+    };
+
+    /**
+     * @brief Returns the buffer size one Frontier needs.
+     * @return Number of candidates of all lengths.
+     */
+    int frontierSize() const;
+
+    /**
+     * @brief Sets up the frontier of a branch.
+     * @param branch The partial layout.
+     * @param buffer Storage of frontierSize() entries for the lists.
+     * @param frontier Receives the legal candidates.
+     * @return false if a remaining ship has too few candidates.
+     */
+    bool start(const Branch& branch, int* buffer, Frontier& frontier) const;
+
+    /**
+     * @brief Narrows a frontier to the candidates left after placing a ship.
+     * @param parent The frontier before placing the ship.
+     * @param slot The next slot to fill.
+     * @param position Position of the placed ship in its parent list.
+     * @param blocked Blocked cells including the placed ship.
+     * @param buffer Storage of frontierSize() entries for the lists.
+     * @param child Receives the legal candidates.
+     * @return false if a remaining ship has too few candidates.
+     */
+    bool narrow(const Frontier& parent, int slot, int position,
+            Bitboard blocked, int* buffer, Frontier& child) const;
+
+    /**
+     * @brief Counts the completions of a partial layout.
+     * @param slot The next slot to fill.
+     * @param blocked Blocked cells of the placed ships.
+     * @param occupied Cells of the placed ships.
+     * @param frontier The legal candidates of the remaining ships.
+     * @param buffer Storage for the frontiers of the deeper slots.
+     * @return Number of consistent completions.
+     */
+    std::uint64_t countFrom(int slot, Bitboard blocked, Bitboard occupied,
+            const Frontier& frontier, int* buffer) const;
+
+    /**
+     * @brief Visits the completions of a partial layout.
+     * @param slot The next slot to fill.
+     * @param blocked Blocked cells of the placed ships.
+     * @param occupied Cells of the placed ships.
+     * @param frontier The legal candidates of the remaining ships.
+     * @param buffer Storage for the frontiers of the deeper slots.
+     * @param layout The placed ships; restored before returning.
+     * @param visitor Receives each complete layout.
+     * @param worker Number of the running worker.
+     */
+    void visitFrom(int slot, Bitboard blocked, Bitboard occupied,
+            const Frontier& frontier, int* buffer, Layout& layout,
+            const Visitor& visitor, unsigned worker) const;
+
+    /**
+     * @brief Counts the completions of a branch.
+     * @param branch The partial layout.
+     * @return Number of consistent completions, not weighted.
+     */
+    std::uint64_t countBranch(const Branch& branch) const;
+
+    /**
+     * @brief Visits the completions of a branch.
+     * @param branch The partial layout.
+     * @param visitor Receives each complete layout.
+     * @param worker Number of the running worker.
+     */
+    void visitBranch(const Branch& branch, const Visitor& visitor,
+            unsigned worker) const;
+
+    /**
+     * @brief Returns the first candidate position for a slot.
+     * @param slot The slot to fill.
+     * @param previous Candidate position of the ship in slot - 1.
+     * @return previous + 1 for a ship of the same length as before, else 0.
+     */
+    int firstCandidate(int slot, int previous) const {
+        return slot > 0 && slotLengths[slot - 1] == slotLengths[slot]
+                ? previous + 1 : 0;
+    }
+
+public:
+    /**
+     * @brief Constructor to search the fleet of a rule set.
+     *
+     * @param rules The board, fleet and touching rule.
+     * @throws std::invalid_argument if the rule set is not valid.
+     */
+    explicit FleetEnumerator(const RuleSet& rules = STANDARD_RULES);
+
+    /**
+     * @brief Restricts the search to layouts consistent with a shot record.
+     *
+     * @param knowledge The constraints; an empty record removes them.
+     */
+    void setKnowledge(const ShotKnowledge& knowledge);
+
+    /**
+     * @brief Getter method to retrieve the placements that layouts refer to.
+     *
+     * @return A constant reference to the placement table of the rules.
+     */
+    const PlacementTable& getTable() const;
+
+    /**
+     * @brief Counts the consistent layouts on the calling thread.
+     *
+     * @return The number of layouts.
+     */
+    std::uint64_t count() const;
+
+    /**
+     * @brief Counts the consistent layouts on all workers of a pool.
+     *
+     * @param pool The workers to use.
+     * @return The number of layouts.
+     */
+    std::uint64_t count(ThreadPool& pool) const;
+
+    /**
+     * @brief Visits every consistent layout on the calling thread.
+     *
+     * @param visitor Receives each layout; worker is always 0.
+     */
+    void enumerate(const Visitor& visitor) const;
+
+    /**
+     * @brief Visits every consistent layout on all workers of a pool.
+     *
+     * @param pool The workers to use.
+     * @param visitor Receives each layout; called concurrently from
+     *        different workers.
+     */
+    void enumerate(ThreadPool& pool, const Visitor& visitor) const;
+};
+
+#endif /* FLEETENUMERATOR_H_ */
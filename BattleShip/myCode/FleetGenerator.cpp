@@ -0,0 +1,370 @@
+/**
+ * @file FleetGenerator.cpp
+ * @brief Implementation file for the FleetGenerator class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "FleetGenerator.h"
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+/**
+ * @brief Constructor to create a generator for a built-in policy.
+ *
+ * @param rules The rules of the generated fleets.
+ * @param policy The distribution of the layouts; not CUSTOM.
+ * @throws std::invalid_argument if the rules are not valid or the policy is
+ *         CUSTOM.
+ */
+FleetGenerator::FleetGenerator(const RuleSet& rules, Policy policy)
+    : rules{rules}, policy{policy}, sweeps{DEFAULT_SWEEPS},
+      maxAttempts{DEFAULT_MAX_ATTEMPTS}, chainReady{false} {
+    if (policy == CUSTOM) {
+        throw invalid_argument(
+                "FleetGenerator: CUSTOM needs a weight function");
+    }
+    initialize();
+
+    if (policy == AVOID_EDGES) {
+        int rows = rules.getRows();
+        int columns = rules.getColumns();
+        Bitboard border;
+        for (int cell = 0; cell < rules.getCells(); cell++) {
+            int rowIndex = cell / columns;
+            int columnIndex = cell % columns;
+            if (rowIndex == 0 || rowIndex == rows - 1 || columnIndex == 0
+                    || columnIndex == columns - 1) {
+                border |= Bitboard::cell(cell);
+            }
+        }
+        weights.resize(table->size());
+        for (int index = 0; index < table->size(); index++) {
+            weights[index] = pow(EDGE_FACTOR,
+                    ((*table)[index].occupied & border).count());
+        }
+    } else if (policy == CLUSTERED) {
+        // The blocked masks of the no-touching rules are the halos
+        auto separated = make_unique<PlacementTable>(RuleSet{rules.getRows(),
+                rules.getColumns(), rules.getQuotas(), false});
+        weights.assign(table->size(), 1.0);
+        halos.resize(table->size());
+        for (int index = 0; index < table->size(); index++) {
+            halos[index] = (*separated)[index].blocked;
+        }
+    }
+}
+
+/**
+ * @brief Constructor to create a generator with placement weights.
+ *
+ * @param rules The rules of the generated fleets.
+ * @param weight The weight of a placement.
+ * @throws std::invalid_argument if the rules are not valid.
+ */
+FleetGenerator::FleetGenerator(const RuleSet& rules,
+        const WeightFunction& weight)
+    : rules{rules}, policy{CUSTOM}, sweeps{DEFAULT_SWEEPS},
+      maxAttempts{DEFAULT_MAX_ATTEMPTS}, chainReady{false} {
+    initialize();
+    weights.resize(table->size());
+    for (int index = 0; index < table->size(); index++) {
+        weights[index] = max(0.0, weight((*table)[index]));
+    }
+}
+
+
+/**
+ * @brief Prepares the placement table and ship slots.
+ *
+ * @throws std::invalid_argument if the rules are not valid.
+ */
+void FleetGenerator::initialize() {
+    if (rules.isValid() == false) {
+        throw invalid_argument("FleetGenerator: rule set is not valid");
+    }
+    table = make_shared<const PlacementTable>(rules);
+
+    // Large ships first: they have the fewest legal placements left
+    for (int length = Ship::MAX_LENGTH; length >= Ship::MIN_LENGTH;
+            length--) {
+        slotLengths.insert(slotLengths.end(), rules.getQuota(length), length);
+    }
+    chain.reserve(slotLengths.size());
+}
+
+/**
+ * @brief Getter method to retrieve the policy.
+ *
+ * @return The distribution of the layouts.
+ */
+FleetGenerator::Policy FleetGenerator::getPolicy() const {
+    return policy;
+}
+
+/**
+ * @brief Getter method to retrieve the rules.
+ *
+ * @return A constant reference to the rules of the generated fleets.
+ */
+const RuleSet& FleetGenerator::getRules() const {
+    return rules;
+}
+
+/**
+ * @brief Getter method to retrieve the placements that layouts refer to.
+ *
+ * @return A constant reference to the placement table of the rules.
+ */
+const PlacementTable& FleetGenerator::getTable() const {
+    return *table;
+}
+
+/**
+ * @brief Sets the number of Markov chain sweeps between two fleets.
+ *
+ * @param sweeps Number of sweeps, at least 1.
+ */
+void FleetGenerator::setSweeps(int sweeps) {
+    this->sweeps = max(1, sweeps);
+}
+
+/**
+ * @brief Sets the number of restarts before generate() gives up.
+ *
+ * @param maxAttempts Number of restarts, at least 1.
+ */
+void FleetGenerator::setMaxAttempts(long maxAttempts) {
+    this->maxAttempts = max(1L, maxAttempts);
+}
+
+/**
+ * @brief Forgets the state of the Markov chain.
+ */
+void FleetGenerator::reset() {
+    chainReady = false;
+}
+
+/**
+ * @brief Draws independent uniform layouts until one is legal.
+ *
+ * @details Every ship is drawn among all placements of its length, so every
+ *          ordered tuple of placements is equally likely; a conflict
+ *          restarts the whole fleet, which keeps the accepted layouts
+ *          uniform.
+ *
+ * @param random The source of randomness.
+ * @param layout Receives the layout.
+ * @return true on success, false if maxAttempts were rejected.
+ */
+bool FleetGenerator::sampleExact(Random& random, Layout& layout) const {
+    for (long attempt = 0; attempt < maxAttempts; attempt++) {
+        layout.clear();
+        Bitboard blocked;
+        bool legal = true;
+        for (int length : slotLengths) {
+            int first = table->begin(length);
+            int index = first + static_cast<int>(random.below(
+                    table->end(length) - first));
+            const Placement& placement = (*table)[index];
+            if (placement.occupied.intersects(blocked)) {
+                legal = false;
+                break;
+            }
+            blocked |= placement.blocked;
+            layout.push_back(index);
+        }
+        if (legal) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Draws the ships one after the other among the legal placements,
+ *        proportional to their weight.
+ *
+ * @details Without weights, up to QUICK_TRIES random placements are tried
+ *          before the legal ones are scanned. Only the cost changes: either
+ *          way each legal placement is equally likely.
+ *
+ * @param random The source of randomness.
+ * @param layout Receives the layout.
+ * @return true on success, false after maxAttempts dead ends.
+ */
+bool FleetGenerator::sampleSequential(Random& random, Layout& layout) const {
+    array<int, 2 * Bitboard::CAPACITY> candidates;
+    array<double, 2 * Bitboard::CAPACITY> cumulative;
+
+    for (long attempt = 0; attempt < maxAttempts; attempt++) {
+        layout.clear();
+        Bitboard blocked;
+        Bitboard fleetHalo;
+        bool complete = true;
+        for (int length : slotLengths) {
+            int first = table->begin(length);
+            int last = table->end(length);
+
+            // Without weights a few random tries mostly find a legal
+            // placement; a hit is uniform among the legal ones, like a scan
+            int tried = -1;
+            for (int attempt = 0; weights.empty() && attempt < QUICK_TRIES;
+                    attempt++) {
+                int index = first + static_cast<int>(random.below(
+                        last - first));
+                if ((*table)[index].occupied.intersects(blocked) == false) {
+                    tried = index;
+                    break;
+                }
+            }
+            if (tried >= 0) {
+                blocked |= (*table)[tried].blocked;
+                layout.push_back(tried);
+                continue;
+            }
+
+            int count = 0;
+            double total = 0;
+            for (int index = first; index < last; index++) {
+                if ((*table)[index].occupied.intersects(blocked)) {
+                    continue;
+                }
+                double weight = weights.empty() ? 1.0 : weights[index];
+                if (!halos.empty() && halos[index].intersects(fleetHalo)) {
+                    weight *= CLUSTER_FACTOR;
+                }
+                if (weight > 0) {
+                    total += weight;
+                    candidates[count] = index;
+                    cumulative[count] = total;
+                    count++;
+                }
+            }
+            if (count == 0) {
+                complete = false;
+                break;
+            }
+            double pick = random.uniform() * total;
+            int position = 0;
+            while (position < count - 1 && cumulative[position] <= pick) {
+                position++;
+            }
+            int chosen = candidates[position];
+
+            blocked |= (*table)[chosen].blocked;
+            if (!halos.empty()) {
+                fleetHalo |= halos[chosen];
+            }
+            layout.push_back(chosen);
+        }
+        if (complete) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Advances the Markov chain by a number of sweeps.
+ *
+ * @details Each step proposes to move a random ship to a random placement
+ *          of its length and accepts if no other ship is in the way. The
+ *          proposal is symmetric, so the uniform distribution over the
+ *          layouts is stationary.
+ *
+ * @param random The source of randomness.
+ * @param count Number of sweeps.
+ */
+void FleetGenerator::runSweeps(Random& random, int count) {
+    int ships = static_cast<int>(chain.size());
+    if (ships == 0) {
+        return;
+    }
+
+    // blocked masks of the ships before / after each slot; most proposals
+    // are rejected, so they are only rebuilt after a move
+    array<Bitboard, Bitboard::CAPACITY + 1> before;
+    array<Bitboard, Bitboard::CAPACITY + 1> after;
+    bool moved = true;
+    for (long step = 0; step < long(count) * ships; step++) {
+        if (moved) {
+            for (int slot = 0; slot < ships; slot++) {
+                before[slot + 1] = before[slot]
+                        | (*table)[chain[slot]].blocked;
+                after[ships - slot - 1] = after[ships - slot]
+                        | (*table)[chain[ships - slot - 1]].blocked;
+            }
+            moved = false;
+        }
+        int slot = static_cast<int>(random.below(ships));
+        int length = slotLengths[slot];
+        int first = table->begin(length);
+        int proposal = first + static_cast<int>(random.below(
+                table->end(length) - first));
+        if ((*table)[proposal].occupied.intersects(before[slot]
+                | after[slot + 1]) == false) {
+            moved = chain[slot] != proposal;
+            chain[slot] = proposal;
+        }
+    }
+}
+
+/**
+ * @brief Draws a complete legal fleet.
+ *
+ * @param random The source of randomness.
+ * @param layout Receives the placement indices.
+ * @return true on success, false if no legal layout was found within the
+ *         attempt limit.
+ */
+bool FleetGenerator::generate(Random& random, Layout& layout) {
+    switch (policy) {
+    case UNIFORM:
+        return sampleExact(random, layout);
+    case UNIFORM_CHAIN:
+        if (chainReady == false) {
+            if (sampleSequential(random, chain) == false) {
+                return false;
+            }
+            runSweeps(random, BURN_IN_SWEEPS);
+            chainReady = true;
+        }
+        runSweeps(random, sweeps);
+        layout = chain;
+        return true;
+    default:
+        return sampleSequential(random, layout);
+    }
+}
+
+/**
+ * @brief Places a complete legal fleet on an empty grid.
+ *
+ * @param grid An empty grid with the same rules as the generator.
+ * @param random The source of randomness.
+ * @return true if the fleet was placed, false if the grid does not match,
+ *         generate() failed or the grid rejected a ship.
+ */
+bool FleetGenerator::fill(OwnGrid& grid, Random& random) {
+    if (!(grid.getRules() == rules) || !grid.getShips().empty()) {
+        return false;
+    }
+    Layout layout;
+    if (generate(random, layout) == false) {
+        return false;
+    }
+    for (int index : layout) {
+        if (grid.tryPlaceShip((*table)[index].toShip()).isValid() == false) {
+            grid.reset();
+            return false;
+        }
+    }
+    return true;
+}
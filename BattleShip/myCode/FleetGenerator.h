@@ -0,0 +1,235 @@
+/**
+ * @file FleetGenerator.h
+ * @brief Header file for the FleetGenerator class, which draws complete
+ *        random fleets.
+ *
+ * @details A fleet is drawn as a list of indices into the PlacementTable of
+ *          the rules and only converted to Ship objects when an OwnGrid is
+ *          filled. Legality checks are single bit mask intersections, so a
+ *          simulation can start every game from fresh random fleets.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef FLEETGENERATOR_H_
+#define FLEETGENERATOR_H_
+
+#include "OwnGrid.h"
+#include "PlacementTable.h"
+#include "Random.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @class FleetGenerator
+ * @brief Draws legal layouts of the whole fleet of a rule set.
+ *
+ * @details The policy decides the distribution of the layouts:
+ *          - SEQUENTIAL: the default. Ships are drawn one after the other,
+ *            largest first, each uniformly among the placements that are
+ *            still legal; a dead end restarts the fleet. This takes about a
+ *            microsecond per standard fleet, but it is NOT uniform over
+ *            the layouts: a layout is drawn with the product of
+ *            1 / (number of legal placements) over its ships, so layouts in
+ *            which the first ships leave little room for the later ones are
+ *            more likely.
+ *          - UNIFORM: independent, exactly uniform layouts by rejection
+ *            sampling with early restart. Fast for sparse fleets; the
+ *            acceptance rate of the dense standard fleet is about 1e-7,
+ *            i.e. roughly 0.1 s per fleet. Exact sampling that is also
+ *            fast would need the number of completions of every partial
+ *            fleet, and counting the standard fleet's layouts takes
+ *            minutes (see FleetEnumerator).
+ *          - UNIFORM_CHAIN: every legal layout is equally likely in the
+ *            long run. Layouts are produced by a Markov chain that moves one
+ *            ship at a time to a random legal placement; the chain runs a
+ *            number of sweeps (one move proposal per ship each) between two
+ *            fleets. Fast for dense fleets, but consecutive fleets are
+ *            correlated and each depends on all fleets drawn before, so
+ *            reseeding the Random does not reproduce a fleet.
+ *          - AVOID_EDGES, CLUSTERED and CUSTOM: drawn like SEQUENTIAL, but
+ *            with probability proportional to a weight of each placement.
+ *
+ *          Only UNIFORM_CHAIN keeps state between fleets. Generators are not
+ *          thread safe, so each thread needs its own generator (and its own
+ *          Random).
+ */
+class FleetGenerator {
+public:
+    /**
+     * @enum Policy
+     * @brief Distribution of the generated layouts.
+     */
+    enum Policy {
+        SEQUENTIAL,    /**< Each ship uniform among its legal placements;
+                            fast, not uniform over the layouts. */
+        UNIFORM,       /**< Uniform over all layouts, independent samples. */
+        UNIFORM_CHAIN, /**< Uniform over all layouts, Markov chain. */
+        AVOID_EDGES,   /**< Placements on the border are less likely. */
+        CLUSTERED,     /**< Placements close to placed ships are likelier. */
+        CUSTOM         /**< Placement weights from a WeightFunction. */
+    };
+
+    /**
+     * @brief Weight of a placement for the CUSTOM policy; values below 0
+     *        count as 0.
+     */
+    using WeightFunction = std::function<double(const Placement&)>;
+
+    /// A fleet as indices into getTable(), largest ships first.
+    using Layout = std::vector<int>;
+
+    static constexpr int DEFAULT_SWEEPS = 8; ///< Sweeps between two fleets.
+    static constexpr int BURN_IN_SWEEPS = 64; ///< Sweeps before the first.
+    /// Restarts before generate() gives up.
+    static constexpr long DEFAULT_MAX_ATTEMPTS = 1L << 24;
+    /// SEQUENTIAL: random tries per ship before scanning all placements.
+    static constexpr int QUICK_TRIES = 32;
+    static constexpr double EDGE_FACTOR = 0.25; ///< AVOID_EDGES: weight
+                                                ///< factor per border cell.
+    static constexpr double CLUSTER_FACTOR = 8.0; ///< CLUSTERED: weight of a
+                                                  ///< placement near a ship.
+
+private:
+    RuleSet rules; ///< The rules of the generated fleets.
+    Policy policy; ///< The distribution of the layouts.
+    std::shared_ptr<const PlacementTable> table; ///< Placements of the rules.
+    std::vector<int> slotLengths; ///< Length of each ship, largest first.
+    std::vector<double> weights; ///< Weight of each placement; empty for
+                                 ///< SEQUENTIAL and the uniform policies.
+    std::vector<Bitboard> halos; ///< CLUSTERED: cells of each placement and
+                                 ///< their 8-neighbourhood.
+    int sweeps;       ///< UNIFORM_CHAIN: sweeps between two fleets.
+    long maxAttempts; ///< Restarts before generate() gives up.
+    Layout chain;     ///< UNIFORM_CHAIN: current state of the Markov chain.
+    bool chainReady;  ///< UNIFORM_CHAIN: true once chain holds a burnt in
+                      ///< layout.
+
+    /**
+     * @brief Prepares the placement table and ship slots.
+     */
+    void initialize();
+
+    /**
+     * @brief Draws independent uniform layouts until one is legal.
+     * @param random The source of randomness.
+     * @param layout Receives the layout.
+     * @return true on success, false if maxAttempts were rejected.
+     */
+    bool sampleExact(Random& random, Layout& layout) const;
+
+    /**
+     * @brief Draws the ships one after the other among the legal placements,
+     *        proportional to their weight.
+     * @param random The source of randomness.
+     * @param layout Receives the layout.
+     * @return true on success, false after maxAttempts dead ends.
+     */
+    bool sampleSequential(Random& random, Layout& layout) const;
+
+    /**
+     * @brief Advances the Markov chain by a number of sweeps.
+     * @param random The source of randomness.
+     * @param count Number of sweeps.
+     */
+    void runSweeps(Random& random, int count);
+
+public:
+    /**
+     * @brief Constructor to create a generator for a built-in policy.
+     *
+     * @param rules The rules of the generated fleets.
+     * @param policy The distribution of the layouts; not CUSTOM.
+     * @throws std::invalid_argument if the rules are not valid or the policy
+     *         is CUSTOM.
+     */
+    explicit FleetGenerator(const RuleSet& rules = STANDARD_RULES,
+            Policy policy = SEQUENTIAL);
+
+    /**
+     * @brief Constructor to create a generator with placement weights.
+     *
+     * @details The weight of every placement is computed once here.
+     *
+     * @param rules The rules of the generated fleets.
+     * @param weight The weight of a placement.
+     * @throws std::invalid_argument if the rules are not valid.
+     */
+    FleetGenerator(const RuleSet& rules, const WeightFunction& weight);
+
+    /**
+     * @brief Getter method to retrieve the policy.
+     *
+     * @return The distribution of the layouts.
+     */
+    Policy getPolicy() const;
+
+    /**
+     * @brief Getter method to retrieve the rules.
+     *
+     * @return A constant reference to the rules of the generated fleets.
+     */
+    const RuleSet& getRules() const;
+
+    /**
+     * @brief Getter method to retrieve the placements that layouts refer to.
+     *
+     * @return A constant reference to the placement table of the rules.
+     */
+    const PlacementTable& getTable() const;
+
+    /**
+     * @brief Sets the number of Markov chain sweeps between two fleets.
+     *
+     * @details More sweeps make consecutive UNIFORM_CHAIN fleets less
+     *          correlated.
+     *
+     * @param sweeps Number of sweeps, at least 1.
+     */
+    void setSweeps(int sweeps);
+
+    /**
+     * @brief Sets the number of restarts before generate() gives up.
+     *
+     * @param maxAttempts Number of restarts, at least 1.
+     */
+    void setMaxAttempts(long maxAttempts);
+
+    /**
+     * @brief Forgets the state of the Markov chain.
+     *
+     * @details The next UNIFORM_CHAIN fleet starts a new chain, burnt in
+     *          with the Random it is drawn from, so it no longer depends on
+     *          earlier fleets. The other policies keep no state.
+     */
+    void reset();
+
+    /**
+     * @brief Draws a complete legal fleet.
+     *
+     * @param random The source of randomness.
+     * @param layout Receives the placement indices; reuse it between calls
+     *        to avoid allocations.
+     * @return true on success, false if no legal layout was found within the
+     *         attempt limit (e.g. the fleet does not fit the board).
+     */
+    bool generate(Random& random, Layout& layout);
+
+    /**
+     * @brief Places a complete legal fleet on an empty grid.
+     *
+     * @param grid An empty grid with the same rules as the generator.
+     * @param random The source of randomness.
+     * @return true if the fleet was placed, false if the grid does not match,
+     *         generate() failed or the grid rejected a ship; the grid is
+     *         left empty then.
+     */
+    bool fill(OwnGrid& grid, Random& random);
+};
+
+#endif /* FLEETGENERATOR_H_ */
@@ -0,0 +1,230 @@
+/**
+ * @file FleetSampler.cpp
+ * @brief Implementation file for the FleetSampler class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "FleetSampler.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+/**
+ * @brief Adds the sums of another task.
+ *
+ * @param other The sums to add.
+ */
+void FleetSampler::Accumulator::merge(const Accumulator& other) {
+    samples += other.samples;
+    validSamples += other.validSamples;
+    weight += other.weight;
+    weightSquared += other.weightSquared;
+    for (int cell = 0; cell < Bitboard::CAPACITY; cell++) {
+        occupied[cell] += other.occupied[cell];
+        occupiedSquared[cell] += other.occupiedSquared[cell];
+    }
+}
+
+/**
+ * @brief Constructor to prepare the placements of a rule set.
+ *
+ * @param rules The rules of the opponent's grid.
+ * @throws std::invalid_argument if the rule set is not valid.
+ */
+FleetSampler::FleetSampler(const RuleSet& rules) : rules{rules} {
+    if (rules.isValid() == false) {
+        throw invalid_argument("FleetSampler: rule set is not valid");
+    }
+    table = make_shared<const PlacementTable>(rules);
+}
+
+/**
+ * @brief Draws one fleet.
+ *
+ * @details The weight is the product of the number of choices at every
+ *          step. In the second phase equal ships may be drawn in any order,
+ *          so the weight is divided by the number of orders.
+ *
+ * @param candidates The placements allowed by the shot record.
+ * @param hits The cells that must be covered.
+ * @param random The source of randomness.
+ * @param occupied Receives the cells of the fleet.
+ * @return The importance weight, 0 for a dead end.
+ */
+double FleetSampler::draw(const Candidates& candidates, Bitboard hits,
+        Random& random, Bitboard& occupied) const {
+    RuleSet::Quota quota = rules.getQuotas();
+    array<int, PlacementTable::MAX_PLACEMENTS> options;
+    Bitboard blocked;
+    occupied = Bitboard{};
+    double weight = 1;
+
+    // Cover the hits, one uncovered hit at a time
+    for (Bitboard open = hits; open.any(); open = hits & ~occupied) {
+        uint32_t count = 0;
+        for (int index : candidates.byCell[open.first()]) {
+            const Placement& placement = (*table)[index];
+            if (quota[placement.length] > 0
+                    && !placement.occupied.intersects(blocked)) {
+                options[count++] = index;
+            }
+        }
+        if (count == 0) {
+            return 0;
+        }
+        const Placement& chosen = (*table)[options[random.below(count)]];
+        weight *= count;
+        quota[chosen.length]--;
+        blocked |= chosen.blocked;
+        occupied |= chosen.occupied;
+    }
+
+    // Place the other ships in the water that is left
+    for (int length = Ship::MAX_LENGTH; length >= Ship::MIN_LENGTH;
+            length--) {
+        for (int ship = 1; ship <= quota[length]; ship++) {
+            uint32_t count = 0;
+            for (int index : candidates.byLength[length]) {
+                if (!(*table)[index].occupied.intersects(blocked)) {
+                    options[count++] = index;
+                }
+            }
+            if (count == 0) {
+                return 0;
+            }
+            const Placement& chosen = (*table)[options[random.below(count)]];
+            weight *= double(count) / ship;
+            blocked |= chosen.blocked;
+            occupied |= chosen.occupied;
+        }
+    }
+    return weight;
+}
+
+/**
+ * @brief Computes the estimate from the sums.
+ *
+ * @details The standard error of a cell is the delta method error of the
+ *          self-normalised estimator: sqrt(sum of w^2 (x - p)^2) / sum of w.
+ *
+ * @param total The sums of all tasks.
+ * @return The estimate.
+ */
+SampleEstimate FleetSampler::estimate(const Accumulator& total) const {
+    SampleEstimate result;
+    result.samples = total.samples;
+    result.validSamples = total.validSamples;
+    if (total.weight <= 0) {
+        return result;
+    }
+    result.effectiveSampleSize = total.weight * total.weight
+            / total.weightSquared;
+    for (int cell = 0; cell < rules.getCells(); cell++) {
+        double probability = total.occupied[cell] / total.weight;
+        double spread = total.occupiedSquared[cell] * (1 - 2 * probability)
+                + probability * probability * total.weightSquared;
+        result.occupancy[cell] = probability;
+        result.standardError[cell] = sqrt(max(0.0, spread)) / total.weight;
+        result.maxStandardError = max(result.maxStandardError,
+                result.standardError[cell]);
+    }
+    return result;
+}
+
+/**
+ * @brief Estimates the occupancy of each cell from a shot record.
+ *
+ * @param knowledge The missed, hit and sunk cells.
+ * @param budget When to stop.
+ * @param pool The workers to use.
+ * @param seed The seed of the random numbers.
+ * @return The estimate; all zero if no fleet is consistent.
+ */
+SampleEstimate FleetSampler::sample(const ShotKnowledge& knowledge,
+        const SamplerBudget& budget, ThreadPool& pool, uint64_t seed) const {
+    auto started = chrono::steady_clock::now();
+
+    Candidates candidates;
+    for (int index = 0; index < table->size(); index++) {
+        const Placement& placement = (*table)[index];
+        if (knowledge.allows(placement)) {
+            candidates.byLength[placement.length].push_back(index);
+            Bitboard cells = placement.occupied;
+            for (int cell = cells.popFirst(); cell >= 0;
+                    cell = cells.popFirst()) {
+                candidates.byCell[cell].push_back(index);
+            }
+        }
+    }
+
+    Accumulator total;
+    vector<Accumulator> round(ROUND_TASKS);
+    SampleEstimate result;
+    for (uint64_t firstTask = 0; total.samples < budget.maxSamples;
+            firstTask += ROUND_TASKS) {
+        long remaining = budget.maxSamples - total.samples;
+        pool.run(ROUND_TASKS, [&](size_t task, unsigned) {
+            Accumulator& sums = round[task];
+            sums = Accumulator{};
+            long count = min<long>(TASK_SAMPLES,
+                    remaining - long(task) * TASK_SAMPLES);
+            Random random = Random::stream(seed, firstTask + task,
+                    Random::SAMPLING);
+            for (long sample = 0; sample < count; sample++) {
+                Bitboard occupied;
+                double weight = draw(candidates, knowledge.getHits(), random,
+                        occupied);
+                sums.samples++;
+                if (weight <= 0) {
+                    continue;
+                }
+                sums.validSamples++;
+                sums.weight += weight;
+                sums.weightSquared += weight * weight;
+                for (int cell = occupied.popFirst(); cell >= 0;
+                        cell = occupied.popFirst()) {
+                    sums.occupied[cell] += weight;
+                    sums.occupiedSquared[cell] += weight * weight;
+                }
+            }
+        });
+
+        // Merge in task order, so the sums do not depend on the threads
+        for (const Accumulator& sums : round) {
+            total.merge(sums);
+        }
+        result = estimate(total);
+        if (budget.targetError > 0 && total.samples >= budget.minSamples
+                && result.validSamples > 0
+                && result.maxStandardError <= budget.targetError) {
+            result.converged = true;
+            break;
+        }
+        if (budget.maxTime.count() > 0
+                && chrono::steady_clock::now() - started >= budget.maxTime) {
+            break;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Estimates the occupancy of each cell of the opponent's grid.
+ *
+ * @param grid The grid with the results of the player's shots.
+ * @param budget When to stop.
+ * @param pool The workers to use.
+ * @param seed The seed of the random numbers.
+ * @return The estimate; all zero if no fleet is consistent.
+ */
+SampleEstimate FleetSampler::sample(const OpponentGrid& grid,
+        const SamplerBudget& budget, ThreadPool& pool, uint64_t seed) const {
+    return sample(ShotKnowledge{grid}, budget, pool, seed);
+}
@@ -0,0 +1,180 @@
+/**
+ * @file FleetSampler.h
+ * @brief Header file for the FleetSampler class, a Monte Carlo estimator of
+ *        the opponent's fleet from the shots taken so far.
+ *
+ * @details Counting placements ship by ship (see HeatMap) ignores that ships
+ *          must not overlap or touch. The sampler draws complete fleets
+ *          consistent with every shot and estimates for each cell the
+ *          probability that a ship is on it.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef FLEETSAMPLER_H_
+#define FLEETSAMPLER_H_
+
+#include "OpponentGrid.h"
+#include "PlacementTable.h"
+#include "Random.h"
+#include "ShotKnowledge.h"
+#include "ThreadPool.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @struct SamplerBudget
+ * @brief When FleetSampler::sample() stops.
+ *
+ * @details Sampling stops at whichever limit is reached first. Limits are
+ *          checked after every round of FleetSampler::ROUND_SAMPLES.
+ */
+struct SamplerBudget {
+    long maxSamples = 100000; ///< Number of fleets to draw at most.
+    std::chrono::milliseconds maxTime{0}; ///< Time limit; 0 for none.
+    double targetError = 0; ///< Stop once no cell's standard error is
+                            ///< above this; 0 for never.
+    long minSamples = 4096; ///< Fleets to draw before stopping early.
+};
+
+/**
+ * @struct SampleEstimate
+ * @brief Result of FleetSampler::sample().
+ */
+struct SampleEstimate {
+    long samples = 0;      ///< Number of fleets drawn.
+    long validSamples = 0; ///< Fleets that were consistent (weight > 0).
+    double effectiveSampleSize = 0; ///< (sum of weights)^2 / sum of squared
+                                    ///< weights.
+    std::array<double, Bitboard::CAPACITY> occupancy{}; ///< Estimated
+                                    ///< probability of a ship on each cell.
+    std::array<double, Bitboard::CAPACITY> standardError{}; ///< Standard
+                                    ///< error of each occupancy.
+    double maxStandardError = 0; ///< Largest standard error of all cells.
+    bool converged = false; ///< True if targetError was reached.
+};
+
+/**
+ * @class FleetSampler
+ * @brief Sequential importance sampler of fleets consistent with shots.
+ *
+ * @details Each fleet is built in two phases. First, as long as a hit is
+ *          not covered, a ship is placed across the first uncovered hit,
+ *          chosen uniformly among all lengths still available and all legal
+ *          placements through that cell. Then the remaining ships are placed
+ *          uniformly among their legal placements, largest first. Because
+ *          hits are covered by construction, late-game positions with many
+ *          hits do not collapse like rejection sampling does. The fleet's
+ *          weight is the inverse of its proposal probability, so the
+ *          weighted estimates are those of the uniform distribution over all
+ *          consistent layouts.
+ *
+ *          Work is split into tasks of fixed size, each drawing from the
+ *          Random::stream() of its task number, so for a sample budget the
+ *          result only depends on the seed, not on the number of threads.
+ */
+class FleetSampler {
+public:
+    static constexpr int ROUND_TASKS = 16; ///< Tasks per round.
+    static constexpr int TASK_SAMPLES = 256; ///< Fleets per task.
+    static constexpr int ROUND_SAMPLES = ROUND_TASKS * TASK_SAMPLES; ///<
+                                           ///< Fleets between budget checks.
+
+private:
+    /**
+     * @struct Accumulator
+     * @brief Weighted sums of one task.
+     */
+    struct Accumulator {
+        long samples = 0; ///< Fleets drawn.
+        long validSamples = 0; ///< Fleets with weight > 0.
+        double weight = 0; ///< Sum of weights.
+        double weightSquared = 0; ///< Sum of squared weights.
+        std::array<double, Bitboard::CAPACITY> occupied{}; ///< Sum of the
+                                        ///< weights of fleets on each cell.
+        std::array<double, Bitboard::CAPACITY> occupiedSquared{}; ///< Sum
+                                        ///< of their squared weights.
+
+        /**
+         * @brief Adds the sums of another task.
+         * @param other The sums to add.
+         */
+        void merge(const Accumulator& other);
+    };
+
+    /**
+     * @struct Candidates
+     * @brief The placements allowed by a shot record.
+     */
+    struct Candidates {
+        /// Allowed placements of each length.
+        std::array<std::vector<int>, Ship::MAX_LENGTH + 1> byLength;
+        /// Allowed placements through each cell.
+        std::array<std::vector<int>, Bitboard::CAPACITY> byCell;
+    };
+
+    RuleSet rules; ///< The rules of the opponent's grid.
+    std::shared_ptr<const PlacementTable> table; ///< Placements of the rules.
+
+    /**
+     * @brief Draws one fleet.
+     * @param candidates The placements allowed by the shot record.
+     * @param hits The cells that must be covered.
+     * @param random The source of randomness.
+     * @param occupied Receives the cells of the fleet.
+     * @return The importance weight, 0 for a dead end.
+     */
+    double draw(const Candidates& candidates, Bitboard hits, Random& random,
+            Bitboard& occupied) const;
+
+    /**
+     * @brief Computes the estimate from the sums.
+     * @param total The sums of all tasks.
+     * @return The estimate.
+     */
+    SampleEstimate estimate(const Accumulator& total) const;
+
+public:
+    /**
+     * @brief Constructor to prepare the placements of a rule set.
+     *
+     * @param rules The rules of the opponent's grid.
+     * @throws std::invalid_argument if the rule set is not valid.
+     */
+    explicit FleetSampler(const RuleSet& rules = STANDARD_RULES);
+
+    /**
+     * @brief Estimates the occupancy of each cell from a shot record.
+     *
+     * @param knowledge The missed, hit and sunk cells.
+     * @param budget When to stop.
+     * @param pool The workers to use.
+     * @param seed The seed of the random numbers.
+     * @return The estimate; all zero if no fleet is consistent.
+     */
+    SampleEstimate sample(const ShotKnowledge& knowledge,
+            const SamplerBudget& budget, ThreadPool& pool,
+            std::uint64_t seed) const;
+
+    /**
+     * @brief Estimates the occupancy of each cell of the opponent's grid.
+     *
+     * @param grid The grid with the results of the player's shots.
+     * @param budget When to stop.
+     * @param pool The workers to use.
+     * @param seed The seed of the random numbers.
+     * @return The estimate; all zero if no fleet is consistent.
+     */
+    SampleEstimate sample(const OpponentGrid& grid,
+            const SamplerBudget& budget, ThreadPool& pool,
+            std::uint64_t seed) const;
+};
+
+#endif /* FLEETSAMPLER_H_ */
@@ -0,0 +1,98 @@
+/**
+ * @file GameRecord.h
+ * @brief Header file for the GameRecord and ReplayState structures, the
+ *        in-memory form of a recorded game, and the description of the
+ *        binary replay format.
+ *
+ * @details A replay file starts with the four bytes "BSR3" and is followed
+ *          by any number of games. Integers are LEB128 varints (7 bits per
+ *          byte, low bits first). A game is:
+ *          - varint: number of bytes of the game after this field, so a
+ *            reader can skip games without decoding them.
+ *          - byte rows, byte columns.
+ *          - varint: number of moves; varint: keyframe interval K (0 for
+ *            none); varint: number of ships of the first and of the second
+ *            player.
+ *          - one varint for every keyframe, i.e. for every move m = K, 2K,
+ *            ... below the number of moves: the bit offset of its keyframe
+ *            from the previous keyframe, or from the first move for the
+ *            first one.
+ *          - a bit stream, least significant bit of each byte first, padded
+ *            with zero bits to whole bytes. A field that must hold values up
+ *            to n has ReplayBoard::fieldBits(n) bits.
+ *          - both fleets: per ship its length (up to Ship::MAX_LENGTH), its
+ *            top or left cell (up to rows * columns - 1) and, for ships
+ *            longer than one cell, 1 bit set if it is vertical.
+ *          - the moves. Writer and reader follow the game on a ReplayBoard;
+ *            F are the cells the shooter is likely to target next
+ *            (ReplayBoard::getFrontier()) and U the other cells the shooter
+ *            has not shot yet. If F is not empty, 1 bit tells whether the
+ *            target is in F, followed in that case by its rank in F (up to
+ *            |F| - 1). Otherwise the target's rank in U follows, or |U| for a
+ *            target shot before or off the grid (up to |U|); for those, the
+ *            target's rank among the shooter's shot cells follows, or their
+ *            number for an off-grid shot. Before move m of a keyframe,
+ *            the cells shot by the first and by the second player follow
+ *            as two masks of rows * columns bits. Writer and reader restart
+ *            their ReplayBoard from these masks, so the moves after a
+ *            keyframe only depend on it.
+ *
+ *          Impacts are not stored; they follow from the fleets, so a record
+ *          must hold the impacts its fleets imply, as MatchEngine's do.
+ *          Seeking a move decodes the moves from the keyframe before it,
+ *          because each target depends on all earlier shots of its player.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef GAMERECORD_H_
+#define GAMERECORD_H_
+
+#include "Bitboard.h"
+#include "CellIndex.h"
+#include "Ship.h"
+#include "Shot.h"
+#include <array>
+#include <vector>
+
+/**
+ * @struct GameRecord
+ * @brief Both fleets and the ordered shots of one game.
+ *
+ * @details The players take turns: move n is fired by the first player if n
+ *          is even and by the second player otherwise, at the second
+ *          player's fleet or the first player's fleet respectively.
+ */
+struct GameRecord {
+    /**
+     * @struct Move
+     * @brief One shot and its impact.
+     */
+    struct Move {
+        CellIndex target;    ///< The cell shot at; rows * columns if the
+                             ///< shot was off the grid.
+        Shot::Impact impact; ///< The impact reported by the defender.
+    };
+
+    int rows = 0;    ///< Rows of the grids.
+    int columns = 0; ///< Columns of the grids.
+    std::array<std::vector<Ship>, 2> fleets; ///< Each player's ships.
+    std::vector<Move> moves; ///< All shots in the order they were fired.
+};
+
+/**
+ * @struct ReplayState
+ * @brief The shots of a recorded game up to a move.
+ */
+struct ReplayState {
+    int move = 0; ///< Number of moves played.
+    std::array<Bitboard, 2> shots; ///< Cells each player has shot at.
+    std::array<Bitboard, 2> hits;  ///< Cells of the opposing fleet each
+                                   ///< player has hit.
+};
+
+#endif /* GAMERECORD_H_ */
@@ -14,16 +14,10 @@
 
 #include "GridPosition.h"
 #include <iostream>
+#include <limits>
 
 using namespace std;
 
-/**
- * @brief Constructor to initialize a grid position with row and column.
- * @param row Character representing the row.
- * @param column Integer representing the column.
- */
-GridPosition::GridPosition(char row, int column) : row{row}, column{column} {}
-
 /**
  * @brief Constructor to initialize a grid position with a string argument.
  * @param position String representing the grid position (e.g., "B10").
@@ -34,38 +28,52 @@ GridPosition::GridPosition(std::string position)
     : row{position[0]}, column{stoi(position.substr(1))} {}
 
 /**
- * @brief Checks the validity of the grid position.
- * @details Ensures the row is between 'A' and 'Z' and the column is greater
- *          than 0.
- * @return True if the grid position is valid, false otherwise.
+ * @brief Parses a grid position without allocating or throwing.
+ * @details Reads the row letter and accumulates the column digits directly
+ *          from the input, rejecting column 0 and columns that would
+ *          overflow an int.
+ * @param text The characters to parse.
+ * @param position Receives the parsed position on success.
+ * @return OK on success, otherwise the reason the text was rejected.
  */
-bool GridPosition::isValid() const {
-    return (column > 0 && row >= 'A' && row <= 'Z');
-}
+GridPosition::ParseResult GridPosition::parse(std::string_view text,
+        GridPosition& position) noexcept {
+    if (text.empty()) {
+        return EMPTY;
+    }
+    char parsedRow = text[0];
+    if (parsedRow < 'A' || parsedRow > 'Z') {
+        return BAD_ROW;
+    }
+    if (text.size() < 2) {
+        return BAD_COLUMN;
+    }
 
-/**
- * @brief Overloads the equality operator to compare two grid positions.
- * @param other Another GridPosition object to compare.
- * @return True if both positions are the same, false otherwise.
- */
-bool GridPosition::operator==(GridPosition other) const {
-    return (row == other.row) && (column == other.column);
-}
+    int parsedColumn = 0;
+    for (size_t charIndex = 1; charIndex < text.size(); charIndex++) {
+        char digit = text[charIndex];
+        if (digit < '0' || digit > '9'
+                || parsedColumn > (numeric_limits<int>::max() - 9) / 10) {
+            return BAD_COLUMN;
+        }
+        parsedColumn = parsedColumn * 10 + (digit - '0');
+    }
+    if (parsedColumn == 0) {
+        return BAD_COLUMN;
+    }
 
-/**
- * @brief Getter function to retrieve the column position.
- * @return Integer representing the column.
- */
-int GridPosition::getColumn() const {
-    return column;
+    position = GridPosition(parsedRow, parsedColumn);
+    return OK;
 }
 
 /**
- * @brief Getter function to retrieve the row position.
- * @return Character representing the row.
+ * @brief Checks the validity of the grid position.
+ * @details Ensures the row is between 'A' and 'Z' and the column is greater
+ *          than 0.
+ * @return True if the grid position is valid, false otherwise.
  */
-char GridPosition::getRow() const {
-    return row;
+bool GridPosition::isValid() const {
+    return (column > 0 && row >= 'A' && row <= 'Z');
 }
 
 /**
@@ -78,21 +86,6 @@ GridPosition::operator std::string() const {
     return (string(1, row) + to_string(column));
 }
 
-/**
- * @brief Overloads the less-than operator to compare grid positions.
- * @param other Another GridPosition object to compare.
- * @details Compares row ASCII values first; if equal, compares column values.
- * @return True if this position is less than the other, false otherwise.
- */
-bool GridPosition::operator<(GridPosition other) const {
-    if (int(row) < int(other.row)) {
-        return true;
-    } else if (int(row) == int(other.row)) {
-        return column < other.column;
-    }
-    return false;
-}
-
 /**
  * @brief Overloads the << operator for outputting a GridPosition object.
  * @param lhs Output stream to which the position is written.
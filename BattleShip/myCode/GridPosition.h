@@ -18,7 +18,10 @@
 #ifndef GRIDPOSITION_H_
 #define GRIDPOSITION_H_
 
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <string_view>
 
 /**
  * @class GridPosition
@@ -30,6 +33,23 @@
  * and convert them to string format.
  */
 class GridPosition {
+public:
+    /**
+     * @enum ParseResult
+     * @brief Enum to represent the outcome of parsing a grid position.
+     *
+     * - OK: The text was a valid position.
+     * - EMPTY: The text was empty.
+     * - BAD_ROW: The first character is not a row letter 'A'..'Z'.
+     * - BAD_COLUMN: The column is missing, not a number, 0 or too large.
+     */
+    enum ParseResult {
+        OK,         /**< Text parsed successfully */
+        EMPTY,      /**< No characters to parse */
+        BAD_ROW,    /**< Row is not a letter between 'A' and 'Z' */
+        BAD_COLUMN  /**< Column is missing, malformed or out of range */
+    };
+
 private:
     char row;    ///< Row position of the grid, represented by a character.
     int column;  ///< Column position of the grid, represented by an integer.
@@ -40,7 +60,8 @@ public:
      * @param row Character representing the row of the grid.
      * @param column Integer representing the column of the grid.
      */
-    GridPosition(char row, int column);
+    constexpr GridPosition(char row, int column) : row{row}, column{column}
+    {}
 
     /**
      * @brief Constructor to initialize a grid position with a string argument.
@@ -48,6 +69,17 @@ public:
      */
     GridPosition(std::string position);
 
+    /**
+     * @brief Parses a grid position without allocating or throwing.
+     * @details Accepts exactly one row letter followed by decimal digits
+     *          (e.g., "A1", "J10"). On failure the output is left unchanged.
+     * @param text The characters to parse.
+     * @param position Receives the parsed position on success.
+     * @return OK on success, otherwise the reason the text was rejected.
+     */
+    static ParseResult parse(std::string_view text, GridPosition& position)
+            noexcept;
+
     /**
      * @brief Checks the validity of the grid position.
      * @details Ensures that the row is between 'A' and 'Z' and the column is
@@ -61,7 +93,31 @@ public:
      * @param other Another GridPosition object to compare.
      * @return True if both positions are the same, false otherwise.
      */
-    bool operator==(GridPosition other) const;
+    constexpr bool operator==(GridPosition other) const {
+        return (row == other.row) && (column == other.column);
+    }
+
+    /**
+     * @brief Overloads the inequality operator to compare two grid positions.
+     * @param other Another GridPosition object to compare.
+     * @return True if the positions differ, false otherwise.
+     */
+    constexpr bool operator!=(GridPosition other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Checks whether the position lies on a grid of the given size.
+     * @details Rows start at 'A' and columns at 1, so a 10x10 grid accepts
+     *          'A'..'J' and 1..10.
+     * @param rows The number of rows of the grid.
+     * @param columns The number of columns of the grid.
+     * @return True if the position is inside the grid, false otherwise.
+     */
+    constexpr bool isInside(int rows, int columns) const {
+        return row >= 'A' && row < 'A' + rows && column > 0
+                && column <= columns;
+    }
 
     /**
      * @brief Type cast operator to return the grid position as a string.
@@ -74,19 +130,25 @@ public:
      * @param other Another GridPosition object to compare.
      * @return True if this position is less than the other, false otherwise.
      */
-    bool operator<(GridPosition other) const;
+    constexpr bool operator<(GridPosition other) const {
+        return (row < other.row) || (row == other.row && column < other.column);
+    }
 
     /**
      * @brief Getter function to retrieve the column position.
      * @return Integer representing the column of the grid.
      */
-    int getColumn() const;
+    constexpr int getColumn() const {
+        return column;
+    }
 
     /**
      * @brief Getter function to retrieve the row position.
      * @return Character representing the row of the grid.
      */
-    char getRow() const;
+    constexpr char getRow() const {
+        return row;
+    }
 
     /**
      * @brief Overloads the << operator for outputting a GridPosition object.
@@ -105,4 +167,19 @@ public:
  */
 std::ostream& operator<<(std::ostream& lhs, const GridPosition& rhs);
 
+/**
+ * @brief Hash specialization so GridPosition can key unordered containers.
+ * @details Packs the row character and the column into one word; positions
+ *          on any realistic grid produce distinct values.
+ */
+namespace std {
+template<>
+struct hash<GridPosition> {
+    size_t operator()(const GridPosition& position) const noexcept {
+        return (size_t(static_cast<unsigned char>(position.getRow())) << 16)
+                ^ size_t(static_cast<unsigned int>(position.getColumn()));
+    }
+};
+}
+
 #endif /* GRIDPOSITION_H_ */
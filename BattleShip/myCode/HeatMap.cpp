@@ -0,0 +1,322 @@
+/**
+ * @file HeatMap.cpp
+ * @brief Implementation file for the HeatMap class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "HeatMap.h"
+#include <memory>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HEATMAP_HAS_AVX2 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Marks the consistent placements, one at a time.
+ *
+ * @param lows Cells 0 to 63 of the placements.
+ * @param highs Cells 64 to 127 of the placements.
+ * @param count Number of placements.
+ * @param forbidden Cells no placement may cover.
+ * @param hits Cells that were hit.
+ * @param keep Receives 1 for consistent placements, else 0.
+ */
+static void filterScalar(const uint64_t* lows, const uint64_t* highs, int count,
+        Bitboard forbidden, Bitboard hits, unsigned char* keep) {
+    for (int index = 0; index < count; index++) {
+        bool clear = ((lows[index] & forbidden.getLow())
+                | (highs[index] & forbidden.getHigh())) == 0;
+        bool open = ((lows[index] & ~hits.getLow())
+                | (highs[index] & ~hits.getHigh())) != 0;
+        keep[index] = clear && open;
+    }
+}
+
+#ifdef HEATMAP_HAS_AVX2
+/**
+ * @brief Marks the consistent placements, four at a time.
+ *
+ * @param lows Cells 0 to 63 of the placements.
+ * @param highs Cells 64 to 127 of the placements.
+ * @param count Number of placements.
+ * @param forbidden Cells no placement may cover.
+ * @param hits Cells that were hit.
+ * @param keep Receives 1 for consistent placements, else 0.
+ */
+__attribute__((target("avx2")))
+static void filterAvx2(const uint64_t* lows, const uint64_t* highs, int count,
+        Bitboard forbidden, Bitboard hits, unsigned char* keep) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i forbiddenLow = _mm256_set1_epi64x(
+            static_cast<long long>(forbidden.getLow()));
+    const __m256i forbiddenHigh = _mm256_set1_epi64x(
+            static_cast<long long>(forbidden.getHigh()));
+    const __m256i freshLow = _mm256_set1_epi64x(
+            static_cast<long long>(~hits.getLow()));
+    const __m256i freshHigh = _mm256_set1_epi64x(
+            static_cast<long long>(~hits.getHigh()));
+
+    int index = 0;
+    for (; index + 4 <= count; index += 4) {
+        __m256i low = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(lows + index));
+        __m256i high = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(highs + index));
+        __m256i covered = _mm256_or_si256(
+                _mm256_and_si256(low, forbiddenLow),
+                _mm256_and_si256(high, forbiddenHigh));
+        __m256i fresh = _mm256_or_si256(_mm256_and_si256(low, freshLow),
+                _mm256_and_si256(high, freshHigh));
+        // clear and not (no fresh cell)
+        __m256i consistent = _mm256_andnot_si256(
+                _mm256_cmpeq_epi64(fresh, zero),
+                _mm256_cmpeq_epi64(covered, zero));
+        int lanes = _mm256_movemask_pd(_mm256_castsi256_pd(consistent));
+        keep[index] = lanes & 1;
+        keep[index + 1] = (lanes >> 1) & 1;
+        keep[index + 2] = (lanes >> 2) & 1;
+        keep[index + 3] = (lanes >> 3) & 1;
+    }
+    filterScalar(lows + index, highs + index, count - index, forbidden, hits,
+            keep + index);
+}
+#endif
+
+/**
+ * @brief Constructor to prepare the placements of a rule set.
+ *
+ * @param rules The rules of the opponent's grid.
+ * @throws std::invalid_argument if the rule set is not valid.
+ */
+HeatMap::HeatMap(const RuleSet& rules) : rules{rules},
+        fromCache{false}, hitWeight{0}, kernel{SCALAR} {
+    if (rules.isValid() == false) {
+        throw invalid_argument("HeatMap: rule set is not valid");
+    }
+    auto table = make_unique<PlacementTable>(rules);
+    int size = table->size();
+    lows.resize(size);
+    highs.resize(size);
+    cells.resize(size);
+    keep.resize(size);
+    for (int index = 0; index < size; index++) {
+        const Placement& placement = (*table)[index];
+        lows[index] = placement.occupied.getLow();
+        highs[index] = placement.occupied.getHigh();
+        Bitboard covered = placement.occupied;
+        for (int cell = 0; cell < placement.length; cell++) {
+            cells[index][cell] = static_cast<unsigned char>(covered.popFirst());
+        }
+    }
+    for (int length = 0; length <= Ship::MAX_LENGTH + 1; length++) {
+        firstOfLength[length] = length < Ship::MIN_LENGTH ? 0
+                : length > Ship::MAX_LENGTH ? size : table->begin(length);
+    }
+    counts.fill(0);
+    for (Counts& lengthCount : lengthCounts) {
+        lengthCount.fill(0);
+    }
+    setKernel(AVX2);
+}
+
+/**
+ * @brief Checks whether a kernel can run on this processor.
+ *
+ * @param kernel The kernel to check.
+ * @return true if the kernel is compiled in and supported.
+ */
+bool HeatMap::isAvailable(Kernel kernel) {
+    if (kernel == SCALAR) {
+        return true;
+    }
+#ifdef HEATMAP_HAS_AVX2
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Selects the kernel; unavailable kernels fall back to SCALAR.
+ *
+ * @param kernel The kernel to use.
+ */
+void HeatMap::setKernel(Kernel kernel) {
+    this->kernel = isAvailable(kernel) ? kernel : SCALAR;
+}
+
+/**
+ * @brief Getter method to retrieve the kernel in use.
+ *
+ * @return The kernel that compute() runs.
+ */
+HeatMap::Kernel HeatMap::getKernel() const {
+    return kernel;
+}
+
+/**
+ * @brief Sets the extra weight of placements through open hits.
+ *
+ * @param hitWeight Extra weight per covered open hit; 0 by default.
+ */
+void HeatMap::setHitWeight(uint32_t hitWeight) {
+    this->hitWeight = hitWeight;
+}
+
+/**
+ * @brief Computes the heat map for a shot record.
+ *
+ * @param knowledge The missed, hit and sunk cells.
+ * @param remaining Number of ships of each length still afloat.
+ */
+void HeatMap::compute(const ShotKnowledge& knowledge,
+        const RuleSet::Quota& remaining) {
+    counts.fill(0);
+    for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+            length++) {
+        lengthCounts[length].fill(0);
+    }
+    fromCache = false;
+    Bitboard forbidden = knowledge.getMisses() | knowledge.getSunk();
+    Bitboard hits = knowledge.getHits();
+    Bitboard openHits = hits & ~knowledge.getSunk();
+    shot = knowledge.getMisses() | hits;
+
+    for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+            length++) {
+        if (remaining[length] <= 0) {
+            continue;
+        }
+        int first = firstOfLength[length];
+        int count = firstOfLength[length + 1] - first;
+#ifdef HEATMAP_HAS_AVX2
+        if (kernel == AVX2) {
+            filterAvx2(&lows[first], &highs[first], count, forbidden, hits,
+                    &keep[first]);
+        } else
+#endif
+        {
+            filterScalar(&lows[first], &highs[first], count, forbidden,
+                    hits, &keep[first]);
+        }
+
+        // Plain counts per length; the hit weight only adds to the heat
+        uint32_t weight = remaining[length];
+        uint32_t* lengthCount = lengthCounts[length].data();
+        for (int index = first; index < first + count; index++) {
+            if (keep[index] == 0) {
+                continue;
+            }
+            const unsigned char* covered = cells[index].data();
+            for (int cell = 0; cell < length; cell++) {
+                lengthCount[covered[cell]]++;
+            }
+            if (hitWeight == 0) {
+                continue;
+            }
+            Bitboard through = Bitboard{lows[index], highs[index]} & openHits;
+            uint32_t extra = weight * hitWeight * through.count();
+            for (int cell = 0; extra != 0 && cell < length; cell++) {
+                counts[covered[cell]] += extra;
+            }
+        }
+        for (int cell = 0; cell < rules.getCells(); cell++) {
+            counts[cell] += weight * lengthCount[cell];
+        }
+    }
+}
+
+/**
+ * @brief Computes the heat map for the opponent's grid.
+ *
+ * @param grid The grid with the results of the player's shots.
+ */
+void HeatMap::compute(const OpponentGrid& grid) {
+    compute(ShotKnowledge{grid}, grid.getRemainingShips());
+}
+
+/**
+ * @brief Computes the heat map for the opponent's grid, or takes it from a
+ *        cache.
+ *
+ * @param grid The grid with the results of the player's shots.
+ * @param cache Heat maps of earlier states.
+ */
+void HeatMap::compute(const OpponentGrid& grid, Cache& cache) {
+    if (cache.find(grid.getHash(), counts)) {
+        fromCache = true;
+        shot = grid.getWaterMask() | grid.getHitMask();
+        return;
+    }
+    compute(grid);
+    cache.store(grid.getHash(), counts);
+}
+
+/**
+ * @brief Getter method to retrieve the heat of a cell.
+ *
+ * @param position The position of the cell.
+ * @return The weighted number of placements covering the cell, 0 for
+ *         positions outside the grid.
+ */
+uint32_t HeatMap::at(const GridPosition& position) const {
+    if (position.isInside(rules.getRows(), rules.getColumns()) == false) {
+        return 0;
+    }
+    return at(CellIndex::fromPosition(position, rules.getColumns()));
+}
+
+/**
+ * @brief Getter method to retrieve the heat of all cells.
+ *
+ * @return The heat map indexed by CellIndex value.
+ */
+const array<uint32_t, Bitboard::CAPACITY>& HeatMap::getCounts() const {
+    return counts;
+}
+
+/**
+ * @brief Getter method to retrieve the consistent placements of one ship
+ *        length.
+ *
+ * @param length The ship length.
+ * @return The number of consistent placements covering each cell.
+ * @throws std::out_of_range if the length is not a ship length.
+ */
+const HeatMap::Counts& HeatMap::getLengthCounts(int length) const {
+    if (length < Ship::MIN_LENGTH || length > Ship::MAX_LENGTH) {
+        throw out_of_range("HeatMap: not a ship length");
+    }
+    static const Counts NO_COUNTS{};
+    return fromCache ? NO_COUNTS : lengthCounts[length];
+}
+
+/**
+ * @brief Returns the hottest cell that was not shot at.
+ *
+ * @return The target, or A1 if every cell was shot at.
+ */
+GridPosition HeatMap::bestTarget() const {
+    int best = -1;
+    for (int cell = 0; cell < rules.getCells(); cell++) {
+        if (shot.test(cell) == false
+                && (best < 0 || counts[cell] > counts[best])) {
+            best = cell;
+        }
+    }
+    if (best < 0) {
+        return GridPosition{'A', 1};
+    }
+    return CellIndex{static_cast<uint16_t>(best)}.toPosition(
+            rules.getColumns());
+}
@@ -0,0 +1,205 @@
+/**
+ * @file HeatMap.h
+ * @brief Header file for the HeatMap class, the probability density
+ *        targeting engine for the opponent's grid.
+ *
+ * @details For every cell the heat map counts the placements of the
+ *          remaining ships that cover it and are consistent with the shot
+ *          record. Shooting at the hottest cell that was not shot yet is the
+ *          classic probability density strategy. The consistency test of the
+ *          placements runs as a bit mask kernel over a structure of arrays;
+ *          on x86 processors with AVX2 it tests four placements per
+ *          instruction, selected at run time.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef HEATMAP_H_
+#define HEATMAP_H_
+
+#include "OpponentGrid.h"
+#include "PlacementTable.h"
+#include "ShotKnowledge.h"
+#include "TranspositionTable.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class HeatMap
+ * @brief Per-cell count of consistent placements of the remaining ships.
+ *
+ * @details A placement is consistent if it covers no miss and no sunk cell
+ *          and has at least one cell that was not hit yet. For every ship
+ *          length still afloat, getLengthCounts() holds the plain number of
+ *          consistent placements of that length covering each cell.
+ *
+ *          The heat of a cell combines them: each placement counts once per
+ *          remaining ship of its length. With a hit weight, placements
+ *          through open hits (hits not reported SUNKEN) count
+ *          1 + hit weight times per covered open hit, a targeting heuristic
+ *          that finishes wounded ships first; the default hit weight 0 keeps
+ *          the heat an exact placement count.
+ */
+class HeatMap {
+public:
+    /**
+     * @enum Kernel
+     * @brief Implementation of the placement test.
+     */
+    enum Kernel {
+        SCALAR, /**< Portable code, one placement at a time. */
+        AVX2    /**< Four placements per instruction on x86 with AVX2. */
+    };
+
+    /// Heat of every cell, indexed by CellIndex value.
+    using Counts = std::array<std::uint32_t, Bitboard::CAPACITY>;
+    /// Heat maps by OpponentGrid::getHash(); shared by the threads of a
+    /// search whose heat maps use the same rules and hit weight.
+    using Cache = TranspositionTable<Counts>;
+
+private:
+    RuleSet rules; ///< The rules of the opponent's grid.
+    std::vector<std::uint64_t> lows;  ///< Cells 0 to 63 of each placement.
+    std::vector<std::uint64_t> highs; ///< Cells 64 to 127 of each placement.
+    std::vector<std::array<unsigned char, Ship::MAX_LENGTH>> cells; ///< The
+                                     ///< cells covered by each placement.
+    std::array<int, Ship::MAX_LENGTH + 2> firstOfLength; ///< Placement range
+                                                         ///< of each length.
+    std::vector<unsigned char> keep; ///< Kernel output: 1 if consistent.
+    std::array<std::uint32_t, Bitboard::CAPACITY> counts; ///< The heat map.
+    std::array<Counts, Ship::MAX_LENGTH + 1> lengthCounts; ///< Consistent
+                                             ///< placements of each length.
+    bool fromCache; ///< Whether the last heat was taken from a cache.
+    Bitboard shot; ///< Cells shot at in the last computation.
+    std::uint32_t hitWeight; ///< Extra weight per covered open hit.
+    Kernel kernel; ///< The kernel in use.
+
+public:
+    /**
+     * @brief Constructor to prepare the placements of a rule set.
+     *
+     * @details Selects the fastest kernel the processor supports.
+     *
+     * @param rules The rules of the opponent's grid.
+     * @throws std::invalid_argument if the rule set is not valid.
+     */
+    explicit HeatMap(const RuleSet& rules = STANDARD_RULES);
+
+    /**
+     * @brief Checks whether a kernel can run on this processor.
+     *
+     * @param kernel The kernel to check.
+     * @return true if the kernel is compiled in and supported.
+     */
+    static bool isAvailable(Kernel kernel);
+
+    /**
+     * @brief Selects the kernel; unavailable kernels fall back to SCALAR.
+     *
+     * @param kernel The kernel to use.
+     */
+    void setKernel(Kernel kernel);
+
+    /**
+     * @brief Getter method to retrieve the kernel in use.
+     *
+     * @return The kernel that compute() runs.
+     */
+    Kernel getKernel() const;
+
+    /**
+     * @brief Sets the extra weight of placements through open hits.
+     *
+     * @param hitWeight Extra weight per covered open hit; 0, the default,
+     *        counts all consistent placements equally.
+     */
+    void setHitWeight(std::uint32_t hitWeight);
+
+    /**
+     * @brief Computes the heat map for a shot record.
+     *
+     * @param knowledge The missed, hit and sunk cells.
+     * @param remaining Number of ships of each length still afloat.
+     */
+    void compute(const ShotKnowledge& knowledge,
+            const RuleSet::Quota& remaining);
+
+    /**
+     * @brief Computes the heat map for the opponent's grid.
+     *
+     * @details The ships in OpponentGrid::getSunkenShip() are no longer
+     *          counted.
+     *
+     * @param grid The grid with the results of the player's shots.
+     */
+    void compute(const OpponentGrid& grid);
+
+    /**
+     * @brief Computes the heat map for the opponent's grid, or takes it from
+     *        a cache.
+     *
+     * @details A state that is not in the cache is computed and stored.
+     *          Only the heat is cached, so after a cached state
+     *          getLengthCounts() is zero.
+     *
+     * @param grid The grid with the results of the player's shots.
+     * @param cache Heat maps of earlier states.
+     */
+    void compute(const OpponentGrid& grid, Cache& cache);
+
+    /**
+     * @brief Getter method to retrieve the heat of a cell.
+     *
+     * @param cell The linear index of the cell; must be on the grid.
+     * @return The weighted number of placements covering the cell.
+     */
+    std::uint32_t at(CellIndex cell) const {
+        return counts[cell.value()];
+    }
+
+    /**
+     * @brief Getter method to retrieve the heat of a cell.
+     *
+     * @param position The position of the cell.
+     * @return The weighted number of placements covering the cell, 0 for
+     *         positions outside the grid.
+     */
+    std::uint32_t at(const GridPosition& position) const;
+
+    /**
+     * @brief Getter method to retrieve the heat of all cells.
+     *
+     * @return The heat map indexed by CellIndex value.
+     */
+    const std::array<std::uint32_t, Bitboard::CAPACITY>& getCounts() const;
+
+    /**
+     * @brief Getter method to retrieve the consistent placements of one
+     *        ship length.
+     *
+     * @details Counts are not weighted by the number of ships or by hits;
+     *          lengths with no remaining ship are zero.
+     *
+     * @param length The ship length.
+     * @return The number of consistent placements covering each cell,
+     *         indexed by CellIndex value.
+     * @throws std::out_of_range if the length is not a ship length.
+     */
+    const Counts& getLengthCounts(int length) const;
+
+    /**
+     * @brief Returns the hottest cell that was not shot at.
+     *
+     * @details Ties go to the first cell in row-major order.
+     *
+     * @return The target, or A1 if every cell was shot at.
+     */
+    GridPosition bestTarget() const;
+};
+
+#endif /* HEATMAP_H_ */
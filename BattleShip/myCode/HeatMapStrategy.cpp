@@ -0,0 +1,115 @@
+/**
+ * @file HeatMapStrategy.cpp
+ * @brief Implementation file for the HeatMapStrategy class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "HeatMapStrategy.h"
+
+using namespace std;
+
+/**
+ * @brief Constructor to create a strategy.
+ *
+ * @param random Source of all decisions; must outlive the strategy.
+ * @param rules The rules of the games.
+ * @param placement How the own fleet is placed.
+ * @throws std::invalid_argument if the rules are not valid.
+ */
+HeatMapStrategy::HeatMapStrategy(Random& random, const RuleSet& rules,
+        FleetGenerator::Policy placement) : fleets{rules, placement},
+        random{random}, heat{rules}, cache{nullptr}, endgame{nullptr} {
+    heat.setHitWeight(HIT_WEIGHT);
+}
+
+/**
+ * @brief Getter method to retrieve the heat map of the last shot.
+ *
+ * @return A reference to the heat map.
+ */
+HeatMap& HeatMapStrategy::getHeatMap() {
+    return heat;
+}
+
+/**
+ * @brief Looks up heat maps in a cache before computing them.
+ *
+ * @param cache Heat maps of the same rules and hit weight; nullptr computes
+ *        every heat map.
+ */
+void HeatMapStrategy::setCache(HeatMap::Cache* cache) {
+    this->cache = cache;
+}
+
+/**
+ * @brief Asks a solver for the best shot before using the heat map.
+ *
+ * @param endgame Solver of the same rules; nullptr always uses the heat map.
+ */
+void HeatMapStrategy::setEndgameSolver(EndgameSolver* endgame) {
+    this->endgame = endgame;
+}
+
+/**
+ * @brief Places the whole fleet on an empty grid.
+ *
+ * @param grid The empty grid.
+ * @return false if the fleet could not be placed.
+ */
+bool HeatMapStrategy::placeFleet(OwnGrid& grid) {
+    return fleets.fill(grid, random);
+}
+
+/**
+ * @brief Forgets the state of the fleet generator between games.
+ */
+void HeatMapStrategy::reset() {
+    fleets.reset();
+}
+
+/**
+ * @brief Chooses the solver's shot or else the hottest open cell.
+ *
+ * @param grid The results of the own shots so far.
+ * @return The target, or an off-grid index if no cell is open.
+ */
+CellIndex HeatMapStrategy::nextShot(const OpponentGrid& grid) {
+    Bitboard open = grid.getStateMask(OpponentGrid::UNKNOWN)
+            & ~grid.getWaterMask();
+    if (open.none()) {
+        return CellIndex{static_cast<uint16_t>(Bitboard::CAPACITY)};
+    }
+
+    if (endgame != nullptr) {
+        EndgameSolution solution = endgame->solve(grid);
+        if (solution.status == EndgameSolution::SOLVED
+                && solution.target.value() < Bitboard::CAPACITY) {
+            return solution.target;
+        }
+    }
+
+    if (cache != nullptr) {
+        heat.compute(grid, *cache);
+    } else {
+        heat.compute(grid);
+    }
+    uint32_t hottest = 0;
+    Bitboard best;
+    for (int cell = open.popFirst(); cell >= 0; cell = open.popFirst()) {
+        uint32_t value = heat.at(CellIndex{static_cast<uint16_t>(cell)});
+        if (value > hottest || best.none()) {
+            hottest = value;
+            best = Bitboard{};
+        }
+        if (value == hottest) {
+            best |= Bitboard::cell(cell);
+        }
+    }
+    return CellIndex{static_cast<uint16_t>(
+            best.nth(static_cast<int>(random.below(best.count()))))};
+}
@@ -0,0 +1,117 @@
+/**
+ * @file HeatMapStrategy.h
+ * @brief Header file for the HeatMapStrategy class, which shoots at the cell
+ *        covered by the most consistent ship placements.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef HEATMAPSTRATEGY_H_
+#define HEATMAPSTRATEGY_H_
+
+#include "EndgameSolver.h"
+#include "FleetGenerator.h"
+#include "HeatMap.h"
+#include "Random.h"
+#include "Strategy.h"
+
+/**
+ * @class HeatMapStrategy
+ * @brief Strategy that shoots at the hottest open cell of a HeatMap.
+ *
+ * @details The heat map is recomputed from the grid for every shot; ties are
+ *          broken at random. Apart from the given Random, the strategy only
+ *          keeps the Markov chain of a UNIFORM_CHAIN placement between
+ *          games, which reset() forgets. With a cache, heat maps of states seen
+ *          before, also by other strategies sharing the cache, are reused.
+ *          With an EndgameSolver, the solver's shot is taken whenever it
+ *          finds one, i.e. once few cells are uncertain.
+ *
+ *          The heat map weights placements through open hits by HIT_WEIGHT,
+ *          so that a wounded ship is finished before the hunt goes on.
+ */
+class HeatMapStrategy {
+public:
+    static constexpr std::uint32_t HIT_WEIGHT = 20; ///< Extra heat map
+                                                    ///< weight per open hit.
+
+private:
+    FleetGenerator fleets; ///< Places the own fleet.
+    Random& random;        ///< Source of all decisions.
+    HeatMap heat;          ///< Heat of the opponent's cells, reused.
+    HeatMap::Cache* cache; ///< Heat maps of known states, may be nullptr.
+    EndgameSolver* endgame; ///< Solves late positions, may be nullptr.
+
+public:
+    /**
+     * @brief Constructor to create a strategy.
+     *
+     * @param random Source of all decisions; must outlive the strategy.
+     * @param rules The rules of the games.
+     * @param placement How the own fleet is placed.
+     * @throws std::invalid_argument if the rules are not valid.
+     */
+    explicit HeatMapStrategy(Random& random,
+            const RuleSet& rules = STANDARD_RULES,
+            FleetGenerator::Policy placement = FleetGenerator::AVOID_EDGES);
+
+    /**
+     * @brief Getter method to retrieve the heat map of the last shot.
+     *
+     * @return A reference to the heat map, e.g. to change its kernel.
+     */
+    HeatMap& getHeatMap();
+
+    /**
+     * @brief Looks up heat maps in a cache before computing them.
+     *
+     * @param cache Heat maps of the same rules and hit weight, may be shared
+     *        between threads; nullptr computes every heat map.
+     */
+    void setCache(HeatMap::Cache* cache);
+
+    /**
+     * @brief Asks a solver for the best shot before using the heat map.
+     *
+     * @details If the solver does not search, e.g. because too many cells
+     *          are uncertain or its budget runs out, the hottest cell is
+     *          shot.
+     *
+     * @param endgame Solver of the same rules; not shared with other
+     *        threads; nullptr always uses the heat map.
+     */
+    void setEndgameSolver(EndgameSolver* endgame);
+
+    /**
+     * @brief Places the whole fleet on an empty grid.
+     *
+     * @param grid The empty grid.
+     * @return false if the fleet could not be placed.
+     */
+    bool placeFleet(OwnGrid& grid);
+
+    /**
+     * @brief Chooses the solver's shot or else the hottest open cell.
+     *
+     * @param grid The results of the own shots so far.
+     * @return The target, or an off-grid index if no cell is open.
+     */
+    CellIndex nextShot(const OpponentGrid& grid);
+
+    /**
+     * @brief Ignores the result of the last shot; the grid records it.
+     */
+    void observe(CellIndex, Shot::Impact) {
+    }
+
+    /**
+     * @brief Forgets the state of the fleet generator between games.
+     */
+    void reset();
+};
+
+#endif /* HEATMAPSTRATEGY_H_ */
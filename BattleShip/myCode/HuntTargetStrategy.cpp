@@ -0,0 +1,120 @@
+/**
+ * @file HuntTargetStrategy.cpp
+ * @brief Implementation file for the HuntTargetStrategy class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "HuntTargetStrategy.h"
+
+using namespace std;
+
+/**
+ * @brief Constructor to create a strategy.
+ *
+ * @param random Source of all decisions; must outlive the strategy.
+ * @param rules The rules of the games.
+ * @param placement How the own fleet is placed.
+ * @throws std::invalid_argument if the rules are not valid.
+ */
+HuntTargetStrategy::HuntTargetStrategy(Random& random, const RuleSet& rules,
+        FleetGenerator::Policy placement) : fleets{rules, placement},
+        random{random}, rows{rules.getRows()}, columns{rules.getColumns()} {
+    for (int length = 1; length <= Ship::MAX_LENGTH; length++) {
+        for (int row = 0; row < rows; row++) {
+            for (int column = 0; column < columns; column++) {
+                if ((row + column) % length == 0) {
+                    lattices[length] |= Bitboard::cell(row * columns + column);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draws a random cell of a non-empty set.
+ *
+ * @param cells The candidates.
+ * @return The chosen cell.
+ */
+CellIndex HuntTargetStrategy::pick(Bitboard cells) {
+    return CellIndex{static_cast<uint16_t>(
+            cells.nth(static_cast<int>(random.below(cells.count()))))};
+}
+
+/**
+ * @brief Places the whole fleet on an empty grid.
+ *
+ * @param grid The empty grid.
+ * @return false if the fleet could not be placed.
+ */
+bool HuntTargetStrategy::placeFleet(OwnGrid& grid) {
+    return fleets.fill(grid, random);
+}
+
+/**
+ * @brief Forgets the state of the fleet generator between games.
+ */
+void HuntTargetStrategy::reset() {
+    fleets.reset();
+}
+
+/**
+ * @brief Chooses a cell next to a hit, or a hunting cell.
+ *
+ * @param grid The results of the own shots so far.
+ * @return The target, or an off-grid index if no cell is open.
+ */
+CellIndex HuntTargetStrategy::nextShot(const OpponentGrid& grid) {
+    Bitboard open = grid.getStateMask(OpponentGrid::UNKNOWN)
+            & ~grid.getWaterMask();
+    if (open.none()) {
+        return CellIndex{static_cast<uint16_t>(Bitboard::CAPACITY)};
+    }
+
+    // Target mode: open neighbours of the hits of ships afloat
+    const Bitboard hits = grid.getStateMask(OpponentGrid::HIT);
+    Bitboard unvisited = hits;
+    Bitboard targets;
+    Bitboard inLine;
+    for (int cell = unvisited.popFirst(); cell >= 0;
+            cell = unvisited.popFirst()) {
+        int row = cell / columns;
+        int column = cell % columns;
+        const int steps[4] = {-columns, columns, -1, 1};
+        const bool inside[4] = {row > 0, row < rows - 1, column > 0,
+                column < columns - 1};
+        for (int direction = 0; direction < 4; direction++) {
+            int neighbour = cell + steps[direction];
+            if (inside[direction] == false || !open.test(neighbour)) {
+                continue;
+            }
+            targets |= Bitboard::cell(neighbour);
+            // The cell behind is a hit if the opposite step stays inside
+            int behind = cell - steps[direction];
+            if (inside[direction ^ 1] && hits.test(behind)) {
+                inLine |= Bitboard::cell(neighbour);
+            }
+        }
+    }
+    if (inLine.any()) {
+        return pick(inLine);
+    }
+    if (targets.any()) {
+        return pick(targets);
+    }
+
+    // Hunt mode: every ship afloat covers a cell of the lattice of the
+    // shortest one
+    RuleSet::Quota remaining = grid.getRemainingShips();
+    int shortest = 1;
+    while (shortest < Ship::MAX_LENGTH && remaining[shortest] == 0) {
+        shortest++;
+    }
+    Bitboard hunting = open & lattices[shortest];
+    return pick(hunting.any() ? hunting : open);
+}
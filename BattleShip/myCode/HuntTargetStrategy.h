@@ -0,0 +1,90 @@
+/**
+ * @file HuntTargetStrategy.h
+ * @brief Header file for the HuntTargetStrategy class, which searches on a
+ *        lattice and then finishes off every ship it hits.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef HUNTTARGETSTRATEGY_H_
+#define HUNTTARGETSTRATEGY_H_
+
+#include "FleetGenerator.h"
+#include "Random.h"
+#include "Strategy.h"
+#include <array>
+
+/**
+ * @class HuntTargetStrategy
+ * @brief Strategy with a hunt mode and a target mode.
+ *
+ * @details While a hit ship is afloat the strategy shoots at the open cells
+ *          next to its hits, preferring cells in line with two hits.
+ *          Otherwise it hunts on the cells with (row + column) divisible by
+ *          the length of the shortest ship afloat, which every remaining ship
+ *          must cover. Ties are broken at random. Apart from the given
+ *          Random, the strategy only keeps the Markov chain of a
+ *          UNIFORM_CHAIN placement between games, which reset() forgets.
+ */
+class HuntTargetStrategy {
+private:
+    FleetGenerator fleets; ///< Places the own fleet.
+    Random& random;        ///< Source of all decisions.
+    int rows;              ///< Rows of the grid.
+    int columns;           ///< Columns of the grid.
+    std::array<Bitboard, Ship::MAX_LENGTH + 1> lattices; ///< Hunting cells
+                                       ///< for each shortest ship length.
+
+    /**
+     * @brief Draws a random cell of a non-empty set.
+     * @param cells The candidates.
+     * @return The chosen cell.
+     */
+    CellIndex pick(Bitboard cells);
+
+public:
+    /**
+     * @brief Constructor to create a strategy.
+     *
+     * @param random Source of all decisions; must outlive the strategy.
+     * @param rules The rules of the games.
+     * @param placement How the own fleet is placed.
+     * @throws std::invalid_argument if the rules are not valid.
+     */
+    explicit HuntTargetStrategy(Random& random,
+            const RuleSet& rules = STANDARD_RULES,
+            FleetGenerator::Policy placement = FleetGenerator::AVOID_EDGES);
+
+    /**
+     * @brief Places the whole fleet on an empty grid.
+     *
+     * @param grid The empty grid.
+     * @return false if the fleet could not be placed.
+     */
+    bool placeFleet(OwnGrid& grid);
+
+    /**
+     * @brief Chooses a cell next to a hit, or a hunting cell.
+     *
+     * @param grid The results of the own shots so far.
+     * @return The target, or an off-grid index if no cell is open.
+     */
+    CellIndex nextShot(const OpponentGrid& grid);
+
+    /**
+     * @brief Ignores the result of the last shot; the grid records it.
+     */
+    void observe(CellIndex, Shot::Impact) {
+    }
+
+    /**
+     * @brief Forgets the state of the fleet generator between games.
+     */
+    void reset();
+};
+
+#endif /* HUNTTARGETSTRATEGY_H_ */
@@ -0,0 +1,193 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Implementation file for the MappedFile class.
+ *
+ * @details Uses CreateFileMapping/MapViewOfFile on Windows and mmap on POSIX
+ *          systems. Empty files cannot be mapped on either platform, so they
+ *          are reported as open with an empty view.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Marker stored in data for an open but empty file, which has no
+ *        mapping to release.
+ */
+static const char emptyFileContents[1] = {0};
+
+/**
+ * @brief Default constructor creating a closed mapping.
+ */
+MappedFile::MappedFile() : data{nullptr}, size{0}
+#ifdef _WIN32
+        , fileHandle{nullptr}, mappingHandle{nullptr}
+#endif
+{}
+
+/**
+ * @brief Constructor that immediately maps the given file.
+ *
+ * @param path Path of the file to map.
+ */
+MappedFile::MappedFile(const std::string& path) : MappedFile() {
+    open(path);
+}
+
+/**
+ * @brief Move constructor taking over the mapping of another object.
+ *
+ * @param other The object whose mapping is taken over; it is left closed.
+ */
+MappedFile::MappedFile(MappedFile&& other) noexcept : MappedFile() {
+    *this = std::move(other);
+}
+
+/**
+ * @brief Move assignment taking over the mapping of another object.
+ *
+ * @param other The object whose mapping is taken over; it is left closed.
+ * @return Reference to this object.
+ */
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data = exchange(other.data, nullptr);
+        size = exchange(other.size, 0);
+#ifdef _WIN32
+        fileHandle = exchange(other.fileHandle, nullptr);
+        mappingHandle = exchange(other.mappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor releasing the mapping.
+ */
+MappedFile::~MappedFile() {
+    close();
+}
+
+/**
+ * @brief Maps the given file, releasing any previous mapping first.
+ *
+ * @param path Path of the file to map.
+ * @return True if the file could be opened and mapped, false otherwise.
+ */
+bool MappedFile::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        data = emptyFileContents;
+        return true;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+            nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    data = static_cast<const char*>(view);
+    size = size_t(fileSize.QuadPart);
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0) {
+        ::close(file);
+        return false;
+    }
+    if (fileStatus.st_size == 0) {
+        ::close(file);
+        data = emptyFileContents;
+        return true;
+    }
+    void* view = mmap(nullptr, size_t(fileStatus.st_size), PROT_READ,
+            MAP_PRIVATE, file, 0);
+    // The mapping stays valid after the descriptor is closed
+    ::close(file);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    data = static_cast<const char*>(view);
+    size = size_t(fileStatus.st_size);
+#endif
+    return true;
+}
+
+/**
+ * @brief Releases the mapping. Does nothing if no file is mapped.
+ */
+void MappedFile::close() {
+    if (data != nullptr && data != emptyFileContents) {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#else
+        munmap(const_cast<char*>(data), size);
+#endif
+    }
+    data = nullptr;
+    size = 0;
+}
+
+/**
+ * @brief Checks whether a file is currently mapped.
+ *
+ * @return True if a file is mapped (possibly an empty one).
+ */
+bool MappedFile::isOpen() const {
+    return data != nullptr;
+}
+
+/**
+ * @brief Getter method to retrieve the mapped contents.
+ *
+ * @return A view of the file contents, empty if no file is mapped.
+ */
+std::string_view MappedFile::view() const {
+    return string_view(data == nullptr ? emptyFileContents : data, size);
+}
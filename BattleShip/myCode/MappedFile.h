@@ -0,0 +1,101 @@
+/**
+ * @file MappedFile.h
+ * @brief Header file for the MappedFile class, a read-only memory mapping of
+ *        a whole file.
+ *
+ * @details Loaders for recorded games and shot scripts read large files
+ *          sequentially. Mapping the file avoids copying it into a buffer
+ *          first; the contents are exposed as a std::string_view for as long
+ *          as the MappedFile object lives. Windows (MinGW) and POSIX systems
+ *          are supported.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a file mapped into memory.
+ *
+ * @details The mapping is released by close() or by the destructor. Objects
+ *          can be moved but not copied.
+ */
+class MappedFile {
+private:
+    const char* data; ///< Start of the mapped contents, nullptr if closed.
+    std::size_t size; ///< Number of mapped bytes.
+#ifdef _WIN32
+    void* fileHandle;    ///< Windows handle of the opened file.
+    void* mappingHandle; ///< Windows handle of the file mapping object.
+#endif
+
+public:
+    /**
+     * @brief Default constructor creating a closed mapping.
+     */
+    MappedFile();
+
+    /**
+     * @brief Constructor that immediately maps the given file.
+     * @details Check isOpen() to find out whether mapping succeeded.
+     * @param path Path of the file to map.
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * @brief Move constructor taking over the mapping of another object.
+     * @param other The object whose mapping is taken over.
+     */
+    MappedFile(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Move assignment taking over the mapping of another object.
+     * @param other The object whose mapping is taken over.
+     * @return Reference to this object.
+     */
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Destructor releasing the mapping.
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Maps the given file, releasing any previous mapping first.
+     * @param path Path of the file to map.
+     * @return True if the file could be opened and mapped, false otherwise.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Releases the mapping. Does nothing if no file is mapped.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a file is currently mapped.
+     * @return True if a file is mapped (possibly an empty one).
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Getter method to retrieve the mapped contents.
+     * @return A view of the file contents, empty if no file is mapped.
+     */
+    std::string_view view() const;
+};
+
+#endif /* MAPPEDFILE_H_ */
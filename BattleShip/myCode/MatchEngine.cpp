@@ -0,0 +1,215 @@
+/**
+ * @file MatchEngine.cpp
+ * @brief Implementation file for the MatchEngine class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "MatchEngine.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @struct FunctionStrategy
+ * @brief Adapts a MatchPlayer to the strategy interface.
+ */
+struct FunctionStrategy {
+    const MatchPlayer& player; ///< The adapted player.
+
+    /// Places the fleet; a player without placeFleet fails.
+    bool placeFleet(OwnGrid& grid) {
+        return player.placeFleet && player.placeFleet(grid);
+    }
+
+    /// Converts the chosen position; positions off the grid stay off it.
+    CellIndex nextShot(const OpponentGrid& grid) {
+        GridPosition target = player.nextShot(grid);
+        if (target.isInside(grid.getRows(), grid.getColumns()) == false) {
+            return CellIndex{static_cast<uint16_t>(Bitboard::CAPACITY)};
+        }
+        return CellIndex::fromPosition(target, grid.getColumns());
+    }
+
+    /// Function players do not observe results.
+    void observe(CellIndex, Shot::Impact) {
+    }
+};
+
+/**
+ * @brief Constructor to create an engine for a rule set.
+ *
+ * @param rules The rules both players play by.
+ * @throws std::invalid_argument if the rules are not valid.
+ */
+MatchEngine::MatchEngine(const RuleSet& rules) : rules{rules},
+        maxShots{DEFAULT_MAX_SHOTS}, ownGrids{OwnGrid{rules}, OwnGrid{rules}},
+        opponentGrids{OpponentGrid{rules}, OpponentGrid{rules}},
+        record{nullptr} {
+}
+
+/**
+ * @brief Getter method to retrieve the rules.
+ *
+ * @return A constant reference to the rules of the games.
+ */
+const RuleSet& MatchEngine::getRules() const {
+    return rules;
+}
+
+/**
+ * @brief Sets the number of shots each player may fire in a game.
+ *
+ * @param maxShots Number of shots, at least 1.
+ */
+void MatchEngine::setMaxShots(int maxShots) {
+    this->maxShots = max(1, maxShots);
+}
+
+/**
+ * @brief Getter method to retrieve the number of shots per player.
+ *
+ * @return The number of shots each player may fire in a game.
+ */
+int MatchEngine::getMaxShots() const {
+    return maxShots;
+}
+
+/**
+ * @brief Records the following games.
+ *
+ * @param record Receives the games; nullptr stops recording.
+ */
+void MatchEngine::setRecord(GameRecord* record) {
+    this->record = record;
+}
+
+/**
+ * @brief Starts the record of a game with both placed fleets.
+ */
+void MatchEngine::startRecord() {
+    record->rows = rules.getRows();
+    record->columns = rules.getColumns();
+    for (int player = 0; player < 2; player++) {
+        record->fleets[player] = ownGrids[player].getShips();
+    }
+    record->moves.clear();
+}
+
+/**
+ * @brief Empties all grids for a new game.
+ */
+void MatchEngine::reset() {
+    for (int player = 0; player < 2; player++) {
+        ownGrids[player].reset();
+        opponentGrids[player].reset();
+    }
+}
+
+/**
+ * @brief Checks the placed fleets.
+ *
+ * @details A player without a complete fleet loses before the first shot.
+ *
+ * @param firstPlaced True if the first player reported success.
+ * @param secondPlaced True if the second player reported success.
+ * @param result Receives the ending if a fleet is incomplete.
+ * @return false if the game is over before the first shot.
+ */
+bool MatchEngine::checkFleets(bool firstPlaced, bool secondPlaced,
+        MatchResult& result) const {
+    int fleetSize = rules.getFleetSize();
+    firstPlaced = firstPlaced
+            && static_cast<int>(ownGrids[0].getShips().size()) == fleetSize;
+    secondPlaced = secondPlaced
+            && static_cast<int>(ownGrids[1].getShips().size()) == fleetSize;
+    if (firstPlaced && secondPlaced) {
+        return true;
+    }
+    result.ending = MatchResult::INVALID_FLEET;
+    result.winner = firstPlaced ? 0
+            : secondPlaced ? 1 : MatchResult::NO_WINNER;
+    return false;
+}
+
+/**
+ * @brief Fires a shot and records it in the grids and the result.
+ *
+ * @details The engine never undoes a move, so the shot skips the journals
+ *          of both grids and stays a cell index throughout.
+ *
+ * @param shooter 0 for the first player, 1 for the second.
+ * @param target The cell that is shot.
+ * @param result The result of the game so far; winner is set when the
+ *        shot sinks the last ship.
+ * @return The impact of the shot.
+ */
+Shot::Impact MatchEngine::fire(int shooter, CellIndex target,
+        MatchResult& result) {
+    result.turns++;
+    result.shots[shooter]++;
+    if (target.value() >= rules.getCells()) {
+        if (record != nullptr) {
+            record->moves.push_back(GameRecord::Move{CellIndex{
+                    static_cast<uint16_t>(rules.getCells())},
+                    Shot::Impact::NONE});
+        }
+        return Shot::Impact::NONE;
+    }
+
+    OwnGrid& defender = ownGrids[1 - shooter];
+    bool isNewShot = defender.getShotMask().test(target) == false;
+    Shot::Impact impact = defender.takeBlowUnjournaled(target);
+    opponentGrids[shooter].shotResultUnjournaled(target, impact);
+    if (record != nullptr) {
+        record->moves.push_back(GameRecord::Move{target, impact});
+    }
+    if (impact != Shot::Impact::NONE) {
+        result.hits[shooter]++;
+    }
+    if (impact == Shot::Impact::SUNKEN && isNewShot) {
+        result.sunk[shooter]++;
+        if (defender.allShipsSunk()) {
+            result.winner = shooter;
+        }
+    }
+    return impact;
+}
+
+/**
+ * @brief Plays one complete game between two function players.
+ *
+ * @param first The player who shoots first.
+ * @param second The other player.
+ * @return The result of the game.
+ */
+MatchResult MatchEngine::play(const MatchPlayer& first,
+        const MatchPlayer& second) {
+    FunctionStrategy firstStrategy{first};
+    FunctionStrategy secondStrategy{second};
+    return play(firstStrategy, secondStrategy);
+}
+
+/**
+ * @brief Getter method to retrieve a player's fleet in the last game.
+ *
+ * @param player 0 for the first player, 1 for the second.
+ * @return A constant reference to that player's own grid.
+ */
+const OwnGrid& MatchEngine::getOwnGrid(int player) const {
+    return ownGrids[player];
+}
+
+/**
+ * @brief Getter method to retrieve a player's shots in the last game.
+ *
+ * @param player 0 for the first player, 1 for the second.
+ * @return A constant reference to that player's opponent grid.
+ */
+const OpponentGrid& MatchEngine::getOpponentGrid(int player) const {
+    return opponentGrids[player];
+}
@@ -0,0 +1,229 @@
+/**
+ * @file MatchEngine.h
+ * @brief Header file for the MatchEngine class, which plays complete games
+ *        between two players without any console I/O.
+ *
+ * @details The engine owns both sides' grids and routes the result of every
+ *          OwnGrid::takeBlow() into the shooter's OpponentGrid::shotResult().
+ *          The grids are reset, not reallocated, between games, so a
+ *          simulation can play many games with one engine per thread.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef MATCHENGINE_H_
+#define MATCHENGINE_H_
+
+#include "GameRecord.h"
+#include "OpponentGrid.h"
+#include "OwnGrid.h"
+#include "Strategy.h"
+#include <array>
+#include <functional>
+
+/**
+ * @struct MatchPlayer
+ * @brief The decisions of one side of a game as function objects.
+ *
+ * @details Convenient for tests and scripts; a strategy class (see
+ *          Strategy.h) avoids the std::function calls and the position
+ *          conversions.
+ */
+struct MatchPlayer {
+    /// Places the whole fleet on an empty grid; returns false on failure.
+    std::function<bool(OwnGrid&)> placeFleet;
+    /// Chooses the next target from the results of the own shots so far.
+    std::function<GridPosition(const OpponentGrid&)> nextShot;
+};
+
+/**
+ * @struct MatchResult
+ * @brief Result of MatchEngine::play().
+ */
+struct MatchResult {
+    static constexpr int NO_WINNER = -1; ///< winner of a game without one.
+
+    /**
+     * @enum Ending
+     * @brief Why the game ended.
+     */
+    enum Ending {
+        ALL_SUNK,     /**< The winner sank the whole opposing fleet. */
+        SHOT_LIMIT,   /**< Both players used up their shots. */
+        INVALID_FLEET /**< A player did not place a complete fleet. */
+    };
+
+    Ending ending = ALL_SUNK; ///< Why the game ended.
+    int winner = NO_WINNER;   ///< 0 for the first player, 1 for the second.
+    int turns = 0;            ///< Shots fired by both players.
+    std::array<int, 2> shots{}; ///< Shots fired by each player.
+    std::array<int, 2> hits{};  ///< Shots of each player that hit a ship.
+    std::array<int, 2> sunk{};  ///< Ships sunk by each player.
+};
+
+/**
+ * @class MatchEngine
+ * @brief Plays games between two players with alternating shots.
+ *
+ * @details The first player shoots first; a hit does not give an extra
+ *          shot. A player who places an incomplete fleet loses without a
+ *          shot being fired. An engine is not thread safe; use one per
+ *          thread.
+ *
+ *          The game loop is a template over the two strategies, so their
+ *          hooks are called directly. Targets off the grid (index
+ *          rules.getCells() or above) count as missed shots and are not
+ *          recorded.
+ */
+class MatchEngine {
+public:
+    /// Shots each player may fire before the game is called a draw.
+    static constexpr int DEFAULT_MAX_SHOTS = 2 * Bitboard::CAPACITY;
+
+private:
+    RuleSet rules; ///< The rules both players play by.
+    int maxShots;  ///< Shots each player may fire.
+    std::array<OwnGrid, 2> ownGrids; ///< Each player's own fleet.
+    std::array<OpponentGrid, 2> opponentGrids; ///< Each player's shots.
+    GameRecord* record; ///< Receives the moves of a game, may be nullptr.
+
+    /**
+     * @brief Checks the placed fleets.
+     * @param firstPlaced True if the first player reported success.
+     * @param secondPlaced True if the second player reported success.
+     * @param result Receives the ending if a fleet is incomplete.
+     * @return false if the game is over before the first shot.
+     */
+    bool checkFleets(bool firstPlaced, bool secondPlaced,
+            MatchResult& result) const;
+
+    /**
+     * @brief Fires a shot and records it in the grids and the result.
+     * @param shooter 0 for the first player, 1 for the second.
+     * @param target The cell that is shot.
+     * @param result The result of the game so far.
+     * @return The impact of the shot.
+     */
+    Shot::Impact fire(int shooter, CellIndex target, MatchResult& result);
+
+    /**
+     * @brief Empties all grids for a new game.
+     */
+    void reset();
+
+    /**
+     * @brief Starts the record of a game with both placed fleets.
+     */
+    void startRecord();
+
+public:
+    /**
+     * @brief Constructor to create an engine for a rule set.
+     *
+     * @param rules The rules both players play by.
+     * @throws std::invalid_argument if the rules are not valid.
+     */
+    explicit MatchEngine(const RuleSet& rules = STANDARD_RULES);
+
+    /**
+     * @brief Getter method to retrieve the rules.
+     *
+     * @return A constant reference to the rules of the games.
+     */
+    const RuleSet& getRules() const;
+
+    /**
+     * @brief Sets the number of shots each player may fire in a game.
+     *
+     * @param maxShots Number of shots, at least 1.
+     */
+    void setMaxShots(int maxShots);
+
+    /**
+     * @brief Getter method to retrieve the number of shots per player.
+     *
+     * @return The number of shots each player may fire in a game.
+     */
+    int getMaxShots() const;
+
+    /**
+     * @brief Records the following games.
+     *
+     * @details Every play() overwrites the record with its fleets and
+     *          moves, e.g. for a ReplayWriter.
+     *
+     * @param record Receives the games; nullptr stops recording.
+     */
+    void setRecord(GameRecord* record);
+
+    /**
+     * @brief Plays one complete game between two strategies.
+     *
+     * @details Both arguments must be different objects if the strategies
+     *          keep state.
+     *
+     * @param first The strategy that shoots first.
+     * @param second The other strategy.
+     * @return The result of the game.
+     */
+    template <class First, class Second, class = std::enable_if_t<
+            isStrategy<First>::value && isStrategy<Second>::value>>
+    MatchResult play(First& first, Second& second) {
+        MatchResult result;
+        reset();
+        bool firstPlaced = first.placeFleet(ownGrids[0]);
+        bool secondPlaced = second.placeFleet(ownGrids[1]);
+        if (record != nullptr) {
+            startRecord();
+        }
+        if (checkFleets(firstPlaced, secondPlaced, result) == false) {
+            return result;
+        }
+
+        while (result.shots[1] < maxShots) {
+            if ((result.turns & 1) == 0) {
+                CellIndex target = first.nextShot(opponentGrids[0]);
+                first.observe(target, fire(0, target, result));
+            } else {
+                CellIndex target = second.nextShot(opponentGrids[1]);
+                second.observe(target, fire(1, target, result));
+            }
+            if (result.winner != MatchResult::NO_WINNER) {
+                return result;
+            }
+        }
+        result.ending = MatchResult::SHOT_LIMIT;
+        return result;
+    }
+
+    /**
+     * @brief Plays one complete game between two function players.
+     *
+     * @param first The player who shoots first.
+     * @param second The other player.
+     * @return The result of the game.
+     */
+    MatchResult play(const MatchPlayer& first, const MatchPlayer& second);
+
+    /**
+     * @brief Getter method to retrieve a player's fleet in the last game.
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @return A constant reference to that player's own grid.
+     */
+    const OwnGrid& getOwnGrid(int player) const;
+
+    /**
+     * @brief Getter method to retrieve a player's shots in the last game.
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @return A constant reference to that player's opponent grid.
+     */
+    const OpponentGrid& getOpponentGrid(int player) const;
+};
+
+#endif /* MATCHENGINE_H_ */
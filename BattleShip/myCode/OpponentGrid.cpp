@@ -15,8 +15,9 @@
  */
 
 #include "OpponentGrid.h"
-#include <iostream>
-#include <set>
+#include "Zobrist.h"
+#include <algorithm>
+#include <stdexcept>
 
 using namespace std;
 
@@ -26,7 +27,7 @@ using namespace std;
  * @return The number of columns in the grid.
  */
 int OpponentGrid::getColumns() const {
-    return columns;
+    return rules.getColumns();
 }
 
 /**
@@ -35,7 +36,16 @@ int OpponentGrid::getColumns() const {
  * @return The number of rows in the grid.
  */
 int OpponentGrid::getRows() const {
-    return rows;
+    return rules.getRows();
+}
+
+/**
+ * @brief Getter method to retrieve the rules of the grid.
+ *
+ * @return A constant reference to the rule set.
+ */
+const RuleSet& OpponentGrid::getRules() const {
+    return rules;
 }
 
 /**
@@ -54,25 +64,101 @@ const std::vector<Ship>& OpponentGrid::getSunkenShip() const {
  * @param rows The number of rows in the grid.
  * @param columns The number of columns in the grid.
  */
-OpponentGrid::OpponentGrid(int rows, int columns) : rows{rows}, columns{columns}
-{}
+OpponentGrid::OpponentGrid(int rows, int columns)
+    : OpponentGrid{RuleSet{rows, columns, STANDARD_RULES.getQuotas(),
+        STANDARD_RULES.mayShipsTouch()}} {
+}
+
+/**
+ * @brief Constructor to initialize the OpponentGrid with a rule set.
+ *
+ * @param rules The board dimensions, fleet and touching rule.
+ * @throws std::invalid_argument if the rule set is not valid.
+ */
+OpponentGrid::OpponentGrid(const RuleSet& rules) : rules{rules},
+        sunkenLengths{}, hash{0}, journalPosition{0} {
+    if (rules.isValid() == false) {
+        throw invalid_argument("OpponentGrid: rule set is not valid");
+    }
+    // Room for one result per cell and for the whole fleet
+    journal.reserve(rules.getCells());
+    sunkenShip.reserve(rules.getFleetSize());
+}
 
 /**
  * @brief Getter method to retrieve the map of shots and their impacts.
  *
- * @return A constant reference to the map of shot impacts.
+ * @return The map of shot impacts, built from the cell states.
  */
-const std::map<GridPosition, Shot::Impact>& OpponentGrid::getShots() const {
+std::map<GridPosition, Shot::Impact> OpponentGrid::getShots() const {
+    map<GridPosition, Shot::Impact> shots;
+    Bitboard cells = lowPlane | highPlane;
+    for (int cell = cells.popFirst(); cell >= 0; cell = cells.popFirst()) {
+        CellIndex index{static_cast<uint16_t>(cell)};
+        CellState state = getCellState(index);
+        Shot::Impact impact = state == MISS ? Shot::Impact::NONE
+                : state == HIT ? Shot::Impact::HIT : Shot::Impact::SUNKEN;
+        shots.emplace_hint(shots.end(), index.toPosition(rules.getColumns()),
+                impact);
+    }
     return shots;
 }
 
+/**
+ * @brief Getter method to retrieve the state of a position.
+ *
+ * @param position The position to look up.
+ * @return What is known about the position; UNKNOWN outside the grid.
+ */
+OpponentGrid::CellState OpponentGrid::getCellState(
+        const GridPosition& position) const {
+    if (position.isInside(rules.getRows(), rules.getColumns()) == false) {
+        return UNKNOWN;
+    }
+    return getCellState(CellIndex::fromPosition(position,
+            rules.getColumns()));
+}
+
+/**
+ * @brief Getter method to retrieve the cells in a state.
+ *
+ * @param state The state to look for.
+ * @return The cells of the grid that are in that state.
+ */
+Bitboard OpponentGrid::getStateMask(CellState state) const {
+    switch (state) {
+    case MISS:
+        return lowPlane & ~highPlane;
+    case HIT:
+        return highPlane & ~lowPlane;
+    case SUNK:
+        return lowPlane & highPlane;
+    default:
+        return Bitboard::firstCells(rules.getCells())
+                & ~(lowPlane | highPlane);
+    }
+}
+
 /**
  * @brief Getter method to retrieve the list of opponent's ships.
  *
  * @return A constant reference to the vector of opponent's ships.
  */
 const std::vector<Ship>& OpponentGrid::getOpponentShips() const {
-    return opponentShips;
+    return sunkenShip;
+}
+
+/**
+ * @brief Getter method to retrieve the ships that are still afloat.
+ *
+ * @return The number of ships of each length that were not sunk.
+ */
+RuleSet::Quota OpponentGrid::getRemainingShips() const {
+    RuleSet::Quota remaining = rules.getQuotas();
+    for (int length = 0; length <= Ship::MAX_LENGTH; length++) {
+        remaining[length] = max(0, remaining[length] - sunkenLengths[length]);
+    }
+    return remaining;
 }
 
 /**
@@ -87,51 +173,401 @@ const std::vector<Ship>& OpponentGrid::getOpponentShips() const {
  * @param impact The impact of the shot (HIT, SUNKEN, or NONE).
  */
 void OpponentGrid::shotResult(const Shot& shot, Shot::Impact impact) {
-    // Update map shots with the target shot position (GridPosition) and impact
     GridPosition targetShotPosition = shot.getTargetPosition();
-    shots[targetShotPosition] = impact;
-
-    // Check if the opponent's ship is hit
-    for (const auto& ship : opponentShips) {
-        std::set<GridPosition> opponentShipOccupiedPos = ship.occupiedArea();
-
-        if (opponentShipOccupiedPos.find(targetShotPosition) !=
-                opponentShipOccupiedPos.end()) {
-            cout << "Opponent ship is hit by the player" << endl;
-
-            // Check if the shot sinks the ship
-            bool isSunken = true;
-            for (const auto& shipPos : opponentShipOccupiedPos) {
-                if (shots.find(shipPos) == shots.end() ||
-                    (shots[shipPos] != Shot::Impact::HIT &&
-                     shots[shipPos] != Shot::Impact::SUNKEN)) {
-                    isSunken = false;
-                    break;
-                }
-            }
 
-            if (isSunken) {
-                cout << "Opponent ship is sunken by the player" << endl;
-                sunkenShip.push_back(ship);
+    // Shots outside the grid are journaled but tell nothing about the ships
+    if (targetShotPosition.isInside(rules.getRows(), rules.getColumns())) {
+        shotResult(CellIndex::fromPosition(targetShotPosition,
+                rules.getColumns()), impact);
+    } else {
+        shotResult(CellIndex{static_cast<uint16_t>(Bitboard::CAPACITY)},
+                impact);
+    }
+}
 
-                // Mark all positions of the ship as SUNKEN
-                for (const auto& shipPos : opponentShipOccupiedPos) {
-                    shots[shipPos] = Shot::Impact::SUNKEN;
-                }
+/**
+ * @brief Method to record the result of a shot at a cell.
+ *
+ * @param target The cell that was shot; must be on the grid.
+ * @param impact The impact of the shot (HIT, SUNKEN, or NONE).
+ */
+void OpponentGrid::shotResult(CellIndex target, Shot::Impact impact) {
+    // Journal the previous state of everything the result can change
+    JournalEntry entry;
+    entry.target = target;
+    entry.impact = impact;
+    entry.previousLow = lowPlane;
+    entry.previousHigh = highPlane;
+    entry.previousSunkenCount = sunkenShip.size();
+    entry.previousHash = hash;
+    entry.previousHalo = haloCells;
+    entry.previousSunkenLengths = sunkenLengths;
+    journal.resize(journalPosition);
+    journal.push_back(move(entry));
+    journalPosition++;
+
+    applyShotResult(target, impact, &journal.back());
+}
+
+/**
+ * @brief Method to record the result of a shot at a cell that can't be
+ *        undone.
+ *
+ * @param target The cell that was shot; must be on the grid.
+ * @param impact The impact of the shot (HIT, SUNKEN, or NONE).
+ */
+void OpponentGrid::shotResultUnjournaled(CellIndex target,
+        Shot::Impact impact) {
+    applyShotResult(target, impact, nullptr);
+}
+
+/**
+ * @brief Records a shot result without journaling it.
+ *
+ * @details Updates the inference incrementally; a result that contradicts
+ *          an earlier result of the same cell drops the sunken ships that no
+ *          longer lie on SUNK cells, turns their other cells back into hits
+ *          and recomputes the inference and the hash.
+ *
+ * @param target The cell that was shot; ignored if off the grid.
+ * @param impact The reported impact.
+ * @param entry The journal entry of the result, or nullptr.
+ */
+void OpponentGrid::applyShotResult(CellIndex target, Shot::Impact impact,
+        JournalEntry* entry) {
+    // Shots outside the grid tell nothing about the ships
+    if (target.value() >= rules.getCells()) {
+        return;
+    }
+    CellState state = impact == Shot::Impact::NONE ? MISS
+            : impact == Shot::Impact::HIT ? HIT : SUNK;
+    CellState previous = getCellState(target);
+    bool corrected = previous != UNKNOWN && previous != state
+            && !(previous == HIT && state == SUNK);
+    // The surroundings of a sunken ship include the diagonals of its cells
+    if (state == SUNK) {
+        resolveSunkenShip(target, entry);
+    } else {
+        setCellState(target, state);
+        if (state == HIT && rules.mayShipsTouch() == false) {
+            haloCells |= diagonalNeighbours(target);
+        }
+    }
+    if (corrected) {
+        // Ships that lost a SUNK cell were never sunk; their other cells
+        // are hits again
+        Bitboard sunkCells = lowPlane & highPlane;
+        Bitboard dropped;
+        Bitboard kept;
+        for (size_t index = sunkenShip.size(); index-- > 0;) {
+            Bitboard shipCells = sunkenShip[index].occupiedMask(rules);
+            if ((shipCells & ~sunkCells).any()) {
+                dropped |= shipCells;
+                removeSunkenShip(index, entry);
+            } else {
+                kept |= shipCells;
             }
-            return; // No need to check further ships
+        }
+        lowPlane &= ~(dropped & sunkCells & ~kept);
+        rebuildInference();
+        rehash();
+    }
+}
+
+/**
+ * @brief Changes the state of a cell.
+ *
+ * @param cell The cell; must be on the grid.
+ * @param state The new state.
+ */
+void OpponentGrid::setCellState(CellIndex cell, CellState state) {
+    hash ^= ZOBRIST.cellKey(cell.value(), getCellState(cell))
+            ^ ZOBRIST.cellKey(cell.value(), state);
+    Bitboard mask = Bitboard::cell(cell);
+    lowPlane = (state & 1) ? lowPlane | mask : lowPlane & ~mask;
+    highPlane = (state & 2) ? highPlane | mask : highPlane & ~mask;
+}
+
+/**
+ * @brief Removes a ship from sunkenShip and journals it.
+ *
+ * @details The ship is journaled by its two end cells, so the entry needs
+ *          no memory of its own.
+ *
+ * @param index The index of the ship in sunkenShip.
+ * @param entry The journal entry of the result, or nullptr.
+ */
+void OpponentGrid::removeSunkenShip(size_t index, JournalEntry* entry) {
+    if (entry != nullptr) {
+        const Ship& ship = sunkenShip[index];
+        RemovedShip& removed = entry->removed[entry->removedCount++];
+        removed.index = static_cast<uint16_t>(index);
+        removed.bow = CellIndex::fromPosition(ship.getBow(),
+                rules.getColumns());
+        removed.stern = CellIndex::fromPosition(ship.getStern(),
+                rules.getColumns());
+    }
+    sunkenShip.erase(sunkenShip.begin() + index);
+}
+
+/**
+ * @brief Resolves the ship sunk by a shot and updates the inference.
+ *
+ * @details The ship is the longest straight run of hit cells through the
+ *          target. If ships may not touch, earlier sunken ships on that run
+ *          were reported by the same ship and are replaced. If ships may
+ *          touch, they are different ships and the run stops at them. If no
+ *          ship of the length of the run remains afloat, e.g. for a lone
+ *          SUNKEN cell that later reports will extend, only the target is
+ *          marked SUNK.
+ *
+ * @param target The cell reported as SUNKEN; must be on the grid.
+ * @param entry The journal entry of the result, or nullptr.
+ */
+void OpponentGrid::resolveSunkenShip(CellIndex target, JournalEntry* entry) {
+    int columns = rules.getColumns();
+    Bitboard apartCells;
+    if (rules.mayShipsTouch()) {
+        for (const Ship& sunken : sunkenShip) {
+            apartCells |= sunken.occupiedMask(rules);
+        }
+    }
+    Bitboard runCells = highPlane & ~apartCells;
+    auto isHit = [&](int rowIndex, int columnIndex) {
+        return rowIndex >= 0 && rowIndex < rules.getRows()
+                && columnIndex >= 0 && columnIndex < columns
+                && runCells.test(CellIndex::fromRowColumn(rowIndex,
+                        columnIndex, columns));
+    };
+
+    // Measure the runs of hits through the target in both directions
+    int rowIndex = target.rowIndex(columns);
+    int columnIndex = target.columnIndex(columns);
+    int left = columnIndex;
+    int right = columnIndex;
+    int top = rowIndex;
+    int bottom = rowIndex;
+    while (isHit(rowIndex, left - 1)) {
+        left--;
+    }
+    while (isHit(rowIndex, right + 1)) {
+        right++;
+    }
+    while (isHit(top - 1, columnIndex)) {
+        top--;
+    }
+    while (isHit(bottom + 1, columnIndex)) {
+        bottom++;
+    }
+    Ship ship = right - left >= bottom - top
+            ? Ship{GridPosition{char('A' + rowIndex), left + 1},
+                GridPosition{char('A' + rowIndex), right + 1}}
+            : Ship{GridPosition{char('A' + top), columnIndex + 1},
+                GridPosition{char('A' + bottom), columnIndex + 1}};
+    Bitboard shipCells = ship.occupiedMask(rules);
+
+    // A ship of that length must be afloat or be one of those replaced
+    bool replaces = false;
+    int freedOfLength = 0;
+    for (const Ship& sunken : sunkenShip) {
+        if (sunken.occupiedMask(rules).intersects(shipCells)) {
+            replaces = true;
+            freedOfLength += sunken.length() == ship.length();
         }
     }
+    if (apartCells.test(target) || sunkenLengths[ship.length()] - freedOfLength
+            >= rules.getQuota(ship.length())) {
+        setCellState(target, SUNK);
+        if (rules.mayShipsTouch() == false) {
+            haloCells |= diagonalNeighbours(target);
+        }
+        return;
+    }
+
+    // Replace the ships this one grew from
+    for (size_t index = replaces ? sunkenShip.size() : 0; index-- > 0;) {
+        Bitboard replacedCells = sunkenShip[index].occupiedMask(rules);
+        if (replacedCells.intersects(shipCells)) {
+            sunkenLengths[sunkenShip[index].length()]--;
+            hash ^= Zobrist::shipKey(replacedCells);
+            removeSunkenShip(index, entry);
+        }
+    }
+    sunkenShip.push_back(ship);
+    hash ^= Zobrist::shipKey(shipCells);
+    sunkenLengths[ship.length()]++;
+    haloCells |= ship.blockedMask(rules) & ~shipCells;
+
+    // Mark all positions of the ship as SUNKEN
+    Bitboard changed = shipCells & ~(lowPlane & highPlane);
+    for (int cell = changed.popFirst(); cell >= 0; cell = changed.popFirst()) {
+        CellIndex index{static_cast<uint16_t>(cell)};
+        hash ^= ZOBRIST.cellKey(cell, getCellState(index))
+                ^ ZOBRIST.cellKey(cell, SUNK);
+    }
+    lowPlane |= shipCells;
+    highPlane |= shipCells;
 }
 
 /**
- * @brief Default constructor to initialize an empty OpponentGrid with no rows
- *        or columns.
+ * @brief Returns the diagonal neighbours of a cell.
  *
- * @details This constructor sets grid's rows and columns to zero, indicating
- *          an uninitialized state.
+ * @param cell The cell; must be on the grid.
+ * @return The up to four diagonal neighbours on the grid.
+ */
+Bitboard OpponentGrid::diagonalNeighbours(CellIndex cell) const {
+    int columns = rules.getColumns();
+    int index = cell.value();
+    int rowIndex = index / columns;
+    int columnIndex = index - rowIndex * columns;
+    bool hasLeft = columnIndex > 0;
+    bool hasRight = columnIndex < columns - 1;
+    Bitboard neighbours;
+    if (rowIndex > 0) {
+        if (hasLeft) {
+            neighbours |= Bitboard::cell(index - columns - 1);
+        }
+        if (hasRight) {
+            neighbours |= Bitboard::cell(index - columns + 1);
+        }
+    }
+    if (rowIndex < rules.getRows() - 1) {
+        if (hasLeft) {
+            neighbours |= Bitboard::cell(index + columns - 1);
+        }
+        if (hasRight) {
+            neighbours |= Bitboard::cell(index + columns + 1);
+        }
+    }
+    return neighbours;
+}
+
+/**
+ * @brief Recomputes the inferred state from the planes and sunkenShip.
+ */
+void OpponentGrid::rebuildInference() {
+    haloCells = Bitboard{};
+    sunkenLengths.fill(0);
+    if (rules.mayShipsTouch() == false) {
+        Bitboard cells = highPlane;
+        for (int cell = cells.popFirst(); cell >= 0;
+                cell = cells.popFirst()) {
+            haloCells |= diagonalNeighbours(
+                    CellIndex{static_cast<uint16_t>(cell)});
+        }
+    }
+    for (const Ship& ship : sunkenShip) {
+        sunkenLengths[ship.length()]++;
+        haloCells |= ship.blockedMask(rules) & ~ship.occupiedMask(rules);
+    }
+}
+
+/**
+ * @brief Recomputes the hash from the planes and sunkenShip.
+ */
+void OpponentGrid::rehash() {
+    hash = 0;
+    for (int state = MISS; state <= SUNK; state++) {
+        hash ^= ZOBRIST.cellsKey(getStateMask(static_cast<CellState>(state)),
+                state);
+    }
+    for (const Ship& ship : sunkenShip) {
+        hash ^= Zobrist::shipKey(ship.occupiedMask(rules));
+    }
+}
+
+/**
+ * @brief Default constructor to initialize an OpponentGrid with the standard
+ *        rules.
+ *
+ * @details The opponent is assumed to play on a 10x10 grid with the standard
+ *          fleet.
+ */
+OpponentGrid::OpponentGrid() : OpponentGrid{STANDARD_RULES} {
+}
+
+/**
+ * @brief Method to revert the most recent shotResult().
+ *
+ * @details Restores the journaled state before the result without
+ *          recomputing the inference. Ships the result removed are put back
+ *          from their end cells; sunkenShip keeps its capacity, which it
+ *          had when they were removed, so this does not allocate.
+ *
+ * @return true if a result was reverted, false if there is none.
+ */
+bool OpponentGrid::undo() {
+    if (canUndo() == false) {
+        return false;
+    }
+    const JournalEntry& entry = journal[--journalPosition];
+    lowPlane = entry.previousLow;
+    highPlane = entry.previousHigh;
+    hash = entry.previousHash;
+    haloCells = entry.previousHalo;
+    sunkenLengths = entry.previousSunkenLengths;
+    // Put the removed ships back in reverse order; the ship the result
+    // added, if any, then is the last one
+    for (int removed = entry.removedCount; removed-- > 0;) {
+        const RemovedShip& ship = entry.removed[removed];
+        sunkenShip.insert(sunkenShip.begin() + ship.index,
+                Ship{ship.bow.toPosition(rules.getColumns()),
+                    ship.stern.toPosition(rules.getColumns())});
+    }
+    sunkenShip.erase(sunkenShip.begin() + entry.previousSunkenCount,
+            sunkenShip.end());
+    return true;
+}
+
+/**
+ * @brief Method to re-apply the most recently undone shotResult().
+ *
+ * @return true if a result was re-applied, false if there is none.
+ */
+bool OpponentGrid::redo() {
+    if (canRedo() == false) {
+        return false;
+    }
+    const JournalEntry& entry = journal[journalPosition++];
+    applyShotResult(entry.target, entry.impact, nullptr);
+    return true;
+}
+
+/**
+ * @brief Method to check whether a result can be undone.
+ *
+ * @return true if undo() would revert a result.
+ */
+bool OpponentGrid::canUndo() const {
+    return journalPosition > 0;
+}
+
+/**
+ * @brief Method to check whether a result can be redone.
+ *
+ * @return true if redo() would re-apply a result.
+ */
+bool OpponentGrid::canRedo() const {
+    return journalPosition < journal.size();
+}
+
+/**
+ * @brief Method to forget all journaled results, keeping the current state.
+ */
+void OpponentGrid::clearJournal() {
+    journal.clear();
+    journalPosition = 0;
+}
+
+/**
+ * @brief Method to forget all results, keeping the rules.
  */
-OpponentGrid::OpponentGrid() {
-    rows = 0;
-    columns = 0;
+void OpponentGrid::reset() {
+    sunkenShip.clear();
+    lowPlane = Bitboard{};
+    highPlane = Bitboard{};
+    sunkenLengths.fill(0);
+    haloCells = Bitboard{};
+    hash = 0;
+    clearJournal();
 }
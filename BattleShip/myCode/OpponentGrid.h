@@ -19,9 +19,13 @@
 #ifndef OPPONENTGRID_H_
 #define OPPONENTGRID_H_
 
+#include <array>
 #include <vector>
+#include "Bitboard.h"
+#include "RuleSet.h"
 #include "Ship.h"
 #include "Shot.h"
+#include <cstdint>
 #include <map>
 
 /**
@@ -32,17 +36,147 @@
  *          ships, storing the opponent's ships, tracking the shots taken by
  *          player, and handling results of these shots. The class also tracks
  *          sunken ship & provide methods to retrieve the status of grid & shot
+ *
+ *          Ships are inferred from the reported impacts: a SUNKEN report
+ *          resolves the straight run of hit cells through the target as a
+ *          sunken ship, marks its cells SUNKEN and removes its length from
+ *          the remaining fleet. If ships may not touch, the cells around a
+ *          sunken ship and the diagonal neighbours of every hit are known to
+ *          be water, and callers that report every cell of a sunken ship as
+ *          SUNKEN get one ship, which grows with every report. If ships may
+ *          touch, a sunken ship is never extended, so ships in line with
+ *          each other stay apart. A run whose length has no ship left afloat
+ *          is only marked SUNK until it grows into one. A result that
+ *          contradicts an earlier one for the same cell replaces it; sunken
+ *          ships that lose a SUNK cell are dropped and their other cells are
+ *          hits again.
+ *
+ *          The state of every cell is stored in two bit planes of 2 bits per
+ *          cell (see CellState), so a 10x10 view takes 32 bytes and each
+ *          state is available as a bit mask without scanning the grid.
+ *          Results of shots outside the grid are not stored.
  */
 class OpponentGrid {
+public:
+    /**
+     * @enum CellState
+     * @brief What is known about a cell; the value is its 2-bit code.
+     */
+    enum CellState {
+        UNKNOWN = 0, /**< Not shot at. */
+        MISS = 1,    /**< Reported as NONE. */
+        HIT = 2,     /**< Reported as HIT. */
+        SUNK = 3     /**< Part of a sunken ship. */
+    };
+
 private:
-    int rows;  /**< The number of rows in the grid. */
-    int columns;  /**< The number of columns in the grid. */
+    /**< Board dimensions, fleet and touching rule of the opponent. */
+    RuleSet rules;
     /**< A list that stores the opponent's sunken ships. */
     std::vector<Ship> sunkenShip;
-    /**< A list that stores the opponent's ships. */
-    std::vector<Ship> opponentShips;
-    /**< A map that stores shot impacts for each shot fired on the grid. */
-    std::map<GridPosition, Shot::Impact> shots;
+    /**< Low bit of the CellState code of each cell (MISS or SUNK). */
+    Bitboard lowPlane;
+    /**< High bit of the CellState code of each cell (HIT or SUNK). */
+    Bitboard highPlane;
+    /**< Number of sunken ships of each length. */
+    RuleSet::Quota sunkenLengths;
+    /**< Cells next to hits and sunken ships that can't hold a ship. */
+    Bitboard haloCells;
+    /**< Zobrist hash of the cell states and the sunken ships. */
+    std::uint64_t hash;
+
+    /**
+     * @struct RemovedShip
+     * @brief A sunken ship that a shot result removed from sunkenShip.
+     */
+    struct RemovedShip {
+        std::uint16_t index = 0; /**< Index in sunkenShip before removal. */
+        CellIndex bow;   /**< Bow of the ship. */
+        CellIndex stern; /**< Stern of the ship. */
+    };
+    /**< Most ships one result removes: a new ship replaces at most one per
+         cell, and a correction drops at most the ship on its cell. */
+    static constexpr int MAX_REMOVED = Ship::MAX_LENGTH + 1;
+
+    /**
+     * @struct JournalEntry
+     * @brief The change made by one shotResult() call.
+     */
+    struct JournalEntry {
+        /**< Cell that was shot; off the grid for shots outside it. */
+        CellIndex target{static_cast<std::uint16_t>(Bitboard::CAPACITY)};
+        Shot::Impact impact = Shot::Impact::NONE; /**< Reported impact. */
+        Bitboard previousLow;  /**< lowPlane before the result. */
+        Bitboard previousHigh; /**< highPlane before the result. */
+        std::size_t previousSunkenCount = 0; /**< Size of sunkenShip before. */
+        std::uint64_t previousHash = 0; /**< hash before the result. */
+        Bitboard previousHalo; /**< haloCells before the result. */
+        RuleSet::Quota previousSunkenLengths{}; /**< sunkenLengths before. */
+        int removedCount = 0; /**< Number of used entries of removed. */
+        std::array<RemovedShip, MAX_REMOVED> removed; /**< Ships removed
+                                              from sunkenShip, in order. */
+    };
+    /**< Shot results in the order they were reported, including undone ones. */
+    std::vector<JournalEntry> journal;
+    /**< Number of entries in journal that are currently applied. */
+    std::size_t journalPosition;
+
+    /**
+     * @brief Records a shot result without journaling it.
+     *
+     * @param target The cell that was shot; ignored if off the grid.
+     * @param impact The reported impact.
+     * @param entry The journal entry of the result, or nullptr.
+     */
+    void applyShotResult(CellIndex target, Shot::Impact impact,
+            JournalEntry* entry);
+
+    /**
+     * @brief Changes the state of a cell.
+     *
+     * @param cell The cell; must be on the grid.
+     * @param state The new state.
+     */
+    void setCellState(CellIndex cell, CellState state);
+
+    /**
+     * @brief Removes a ship from sunkenShip and journals it.
+     *
+     * @param index The index of the ship in sunkenShip.
+     * @param entry The journal entry of the result, or nullptr.
+     */
+    void removeSunkenShip(std::size_t index, JournalEntry* entry);
+
+    /**
+     * @brief Resolves the ship sunk by a shot and updates the inference.
+     *
+     * @param target The cell reported as SUNKEN; must be on the grid.
+     * @param entry The journal entry of the result, or nullptr.
+     */
+    void resolveSunkenShip(CellIndex target, JournalEntry* entry);
+
+    /**
+     * @brief Returns the diagonal neighbours of a cell.
+     *
+     * @param cell The cell; must be on the grid.
+     * @return The up to four diagonal neighbours on the grid.
+     */
+    Bitboard diagonalNeighbours(CellIndex cell) const;
+
+    /**
+     * @brief Recomputes the inferred state from the planes and sunkenShip.
+     */
+    void rebuildInference();
+
+    /**
+     * @brief Recomputes the hash from the planes and sunkenShip.
+     */
+    void rehash();
+
+    /// Restores grids from bit planes without replaying their history.
+    friend class BoardCheckpoint;
+    /// Shares grids between snapshots that only differ in their shots.
+    friend class SharedBoard;
 
 public:
     /**
@@ -57,10 +191,18 @@ public:
 
     /**
      * @brief Default constructor to initialize an OpponentGrid
-     * with default dimensions.
+     * with the standard rules.
      */
     OpponentGrid(); /**< Default constructor implementation. */
 
+    /**
+     * @brief Constructor to initialize OpponentGrid with a rule set.
+     *
+     * @param rules The board dimensions, fleet and touching rule.
+     * @throws std::invalid_argument if the rule set is not valid.
+     */
+    explicit OpponentGrid(const RuleSet& rules);
+
     /**
      * @brief Getter method to retrieve the number of columns in the grid.
      *
@@ -75,6 +217,13 @@ public:
      */
     int getRows() const;
 
+    /**
+     * @brief Getter method to retrieve the rules of the grid.
+     *
+     * @return A constant reference to the rule set.
+     */
+    const RuleSet& getRules() const;
+
     /**
      * @brief Getter method to retrieve the list of sunken ships.
      *
@@ -85,11 +234,40 @@ public:
     /**
      * @brief Getter method to retrieve the map of shots and their impacts.
      *
-     * @return A constant reference to the map of shot impacts, where  key is
-     *         position of the shot and the value is impact of the shot (HIT,
-     *         SUNKEN, or NONE).
+     * @details The map is built from the cell states on every call; prefer
+     *          getCellState() and getStateMask() in loops.
+     *
+     * @return The map of shot impacts, where key is position of the shot and
+     *         the value is impact of the shot (HIT, SUNKEN, or NONE).
+     */
+    std::map<GridPosition, Shot::Impact> getShots() const;
+
+    /**
+     * @brief Getter method to retrieve the state of a cell.
+     *
+     * @param cell The cell; must be on the grid.
+     * @return What is known about the cell.
      */
-    const std::map<GridPosition, Shot::Impact>& getShots() const;
+    CellState getCellState(CellIndex cell) const {
+        return static_cast<CellState>(int(lowPlane.test(cell))
+                | int(highPlane.test(cell)) << 1);
+    }
+
+    /**
+     * @brief Getter method to retrieve the state of a position.
+     *
+     * @param position The position to look up.
+     * @return What is known about the position; UNKNOWN outside the grid.
+     */
+    CellState getCellState(const GridPosition& position) const;
+
+    /**
+     * @brief Getter method to retrieve the cells in a state.
+     *
+     * @param state The state to look for.
+     * @return The cells of the grid that are in that state.
+     */
+    Bitboard getStateMask(CellState state) const;
 
     /**
      * @brief Method to record the result of a shot and update the impacts.
@@ -103,12 +281,119 @@ public:
      */
     void shotResult(const Shot& shot, Shot::Impact impact);
 
+    /**
+     * @brief Method to record the result of a shot at a cell.
+     *
+     * @param target The cell that was shot; must be on the grid.
+     * @param impact The impact result of the shot (HIT, SUNKEN, NONE).
+     */
+    void shotResult(CellIndex target, Shot::Impact impact);
+
+    /**
+     * @brief Method to record the result of a shot at a cell that can't be
+     *        undone.
+     *
+     * @details Skips the journal entry of shotResult(), for callers such as
+     *          MatchEngine that never undo. Journaled results before it must
+     *          not be undone either; clear the journal first.
+     *
+     * @param target The cell that was shot; must be on the grid.
+     * @param impact The impact result of the shot (HIT, SUNKEN, NONE).
+     */
+    void shotResultUnjournaled(CellIndex target, Shot::Impact impact);
+
     /**
      * @brief Getter method to retrieve the list of opponent's ships.
      *
+     * @details Only sunken ships can be known exactly, so this is the same
+     *          list as getSunkenShip().
+     *
      * @return A constant reference to the vector of the opponent's ships.
      */
     const std::vector<Ship>& getOpponentShips() const;
+
+    /**
+     * @brief Getter method to retrieve the ships that are still afloat.
+     *
+     * @return The number of ships of each length that were not sunk.
+     */
+    RuleSet::Quota getRemainingShips() const;
+
+    /**
+     * @brief Getter method to retrieve the cells known to be water.
+     *
+     * @return The missed cells and the cells that can't hold a ship
+     *         because of the hits and sunken ships around them.
+     */
+    Bitboard getWaterMask() const {
+        return (lowPlane | haloCells) & ~highPlane;
+    }
+
+    /**
+     * @brief Getter method to retrieve the cells that were hit.
+     *
+     * @return The cells reported as HIT or SUNKEN.
+     */
+    Bitboard getHitMask() const {
+        return highPlane;
+    }
+
+    /**
+     * @brief Getter method to retrieve the Zobrist hash of the grid.
+     *
+     * @details Grids with the same rules, cell states and sunken ships have
+     *          the same hash, whatever the order of the results. The hash is
+     *          updated with every result; the empty grid has hash 0.
+     *
+     * @return The hash of the current state.
+     */
+    std::uint64_t getHash() const {
+        return hash;
+    }
+
+    /**
+     * @brief Method to revert the most recent shotResult().
+     *
+     * @return true if a result was reverted, false if there is none.
+     */
+    bool undo();
+
+    /**
+     * @brief Method to re-apply the most recently undone shotResult().
+     *
+     * @details A new shotResult() discards all undone results.
+     *
+     * @return true if a result was re-applied, false if there is none.
+     */
+    bool redo();
+
+    /**
+     * @brief Method to check whether a result can be undone.
+     *
+     * @return true if undo() would revert a result.
+     */
+    bool canUndo() const;
+
+    /**
+     * @brief Method to check whether a result can be redone.
+     *
+     * @return true if redo() would re-apply a result.
+     */
+    bool canRedo() const;
+
+    /**
+     * @brief Method to forget all journaled results, keeping the current
+     *        state.
+     */
+    void clearJournal();
+
+    /**
+     * @brief Method to forget all results, keeping the rules.
+     *
+     * @details The memory reserved for the journal is kept for the next
+     *          game.
+     */
+    void reset();
 };
 
 #endif /* OPPONENTGRID_H_ */
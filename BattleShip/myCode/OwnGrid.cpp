@@ -14,18 +14,22 @@
  */
 
 #include "OwnGrid.h"
+#include "Zobrist.h"
 #include <iostream>
-#include <algorithm>  // Standard library for algorithms like set_intersection
 #include <set>
+#include <stdexcept>
 using namespace std;
 
+/// Zobrist code of a cell that was shot at.
+static constexpr int SHOT_CODE = 1;
+
 /**
  * @brief Getter method to retrieve the number of columns in the grid.
  *
  * @return The number of columns in the grid.
  */
 int OwnGrid::getColumns() const {
-    return columns;
+    return rules.getColumns();
 }
 
 /**
@@ -34,7 +38,16 @@ int OwnGrid::getColumns() const {
  * @return The number of rows in the grid.
  */
 int OwnGrid::getRows() const {
-    return rows;
+    return rules.getRows();
+}
+
+/**
+ * @brief Getter method to retrieve the rules of the grid.
+ *
+ * @return A constant reference to the rule set.
+ */
+const RuleSet& OwnGrid::getRules() const {
+    return rules;
 }
 
 /**
@@ -46,6 +59,19 @@ const std::vector<Ship>& OwnGrid::getShips() const {
     return ships;
 }
 
+/**
+ * @brief Method to find the ship on a cell.
+ *
+ * @param position The position to look up.
+ * @return The index of the ship in getShips(), or NO_SHIP.
+ */
+int OwnGrid::shipIdAt(const GridPosition& position) const {
+    if (position.isInside(rules.getRows(), rules.getColumns()) == false) {
+        return NO_SHIP;
+    }
+    return shipIdAt(CellIndex::fromPosition(position, rules.getColumns()));
+}
+
 /**
  * @brief Method to place a ship on the grid.
  *
@@ -53,86 +79,124 @@ const std::vector<Ship>& OwnGrid::getShips() const {
  * @return true if the ship was successfully placed, false otherwise.
  */
 bool OwnGrid::placeShip(const Ship &ship) {
-    int shipLength = ship.length();  // Get the ship length
+    return tryPlaceShip(ship).isValid();
+}
 
-    // Display the type of ship based on length
-    if (shipLength == 5) {
-        cout << "Player wishes to place a carrier ship of length 5" << endl;
-    } else if (shipLength == 4) {
-        cout << "Player wishes to place a battleship of length 4" << endl;
-    } else if (shipLength == 3) {
-        cout << "Player wishes to place a destroyer ship of length 3" << endl;
-    } else if (shipLength == 2) {
-        cout << "Player wishes to place a submarine of length 2" << endl;
+/**
+ * @brief Method to place a ship on the grid, reporting why it failed.
+ *
+ * @param ship The ship to be placed.
+ * @return VALID if the ship was placed, otherwise the reason it was not.
+ */
+PlacementResult OwnGrid::tryPlaceShip(const Ship &ship) {
+    PlacementResult result = validatePlacement(ship);
+    if (result.isValid() == false) {
+        return result;
     }
 
-    // Validate the ship's placement
-    if (ship.isValid() == false) {
-        return false;
+    JournalEntry entry;
+    entry.isPlacement = true;
+    entry.ship = ship;
+    entry.previousBlocked = blockedCells;
+    record(entry);
+
+    applyPlacement(ship);
+    return result;
+}
+
+/**
+ * @brief Adds a ship to all data structures without validating it.
+ *
+ * @param ship The ship to add; must be a valid placement.
+ */
+void OwnGrid::applyPlacement(const Ship &ship) {
+    // Decrement the count of ships available for this ship length
+    shipTypes[ship.length()]--;
+
+    // Add the new ship to the grid, counting cells that were already shot
+    Bitboard shipMask = ship.occupiedMask(rules);
+    Bitboard shipCells = shipMask;
+    for (int cell = shipCells.popFirst(); cell >= 0;
+            cell = shipCells.popFirst()) {
+        cellShips[cell] = static_cast<signed char>(ships.size());
     }
+    ships.push_back(ship);
+    hash ^= Zobrist::shipKey(shipMask);
+    blockedCells |= ship.blockedMask(rules);
+    occupiedCells |= shipMask;
+    shipHits.push_back((shipMask & shotMask).count());
+}
 
-    // Check if there is room for more ships of the same length
-    if (shipTypes[shipLength] <= 0) {
-        if (shipTypes[shipLength] == 0) {
-            if (shipLength == 5) {
-                cout << "Only 1 carrier ship can be placed. "
-                		"Carrier ship quantity exceeds" << endl;
-            } else if (shipLength == 4) {
-                cout << "Only 2 battleships can be placed. "
-                		"Battleship quantity exceeds" << endl;
-            } else if (shipLength == 3) {
-                cout << "Only 3 destroyer ships can be placed. "
-                		"Destroyer ship quantity exceeds" << endl;
-            } else if (shipLength == 2) {
-                cout << "Only 4 submarines can be placed. "
-                		"Submarine quantity exceeds" << endl;
-            }
-        }
-        return false;
+/**
+ * @brief Recomputes the hash from the ships and the shot cells.
+ */
+void OwnGrid::rehash() {
+    hash = ZOBRIST.cellsKey(shotMask, SHOT_CODE);
+    for (const Ship& ship : ships) {
+        hash ^= Zobrist::shipKey(ship.occupiedMask(rules));
     }
+}
 
-    // Check if the new ship touches an existing ship
-    set<GridPosition> existingShipsPosition;
-    for (const auto& existingShip : ships) {
-        existingShipsPosition = existingShip.blockedArea();
+/**
+ * @brief Removes the most recently placed ship.
+ *
+ * @param entry The journal entry of that placement.
+ */
+void OwnGrid::revertPlacement(const JournalEntry &entry) {
+    Bitboard shipCells = entry.ship.occupiedMask(rules);
+    for (int cell = shipCells.popFirst(); cell >= 0;
+            cell = shipCells.popFirst()) {
+        cellShips[cell] = NO_SHIP;
     }
-    // New ship's occupied area
-    set<GridPosition> tempShipPosition = ship.occupiedArea();
-    // To store the intersection of blocked areas
-    set<GridPosition> intersectionShips;
+    ships.pop_back();
+    shipHits.pop_back();
+    hash ^= Zobrist::shipKey(entry.ship.occupiedMask(rules));
+    blockedCells = entry.previousBlocked;
+    occupiedCells &= ~entry.ship.occupiedMask(rules);
+    shipTypes[entry.ship.length()]++;
+}
 
-    set_intersection(existingShipsPosition.begin(), existingShipsPosition.end(),
-                      tempShipPosition.begin(), tempShipPosition.end(),
-                      inserter(intersectionShips, intersectionShips.begin()));
+/**
+ * @brief Method to check whether a ship could be placed on the grid.
+ *
+ * @param ship The ship to check.
+ * @return VALID if the ship can be placed, otherwise the reason it can't.
+ */
+PlacementResult OwnGrid::validatePlacement(const Ship &ship) const {
+    // Validate the ship itself
+    PlacementResult result = ship.validate();
+    if (result.isValid() == false) {
+        return result;
+    }
+    int shipLength = result.getShipLength();
 
-    if (!intersectionShips.empty()) {
-        cout << "Ships are touching each other" << endl;
-        return false;
+    // The ship has to fit on this grid
+    if (ship.getBow().isInside(rules.getRows(), rules.getColumns()) == false
+            || ship.getStern().isInside(rules.getRows(), rules.getColumns())
+                == false) {
+        return PlacementResult{PlacementResult::OUT_OF_BOUNDS, shipLength};
     }
 
-    // Decrement the count of ships available for this ship length
-    shipTypes[shipLength]--;
+    // Check if there is room for more ships of the same length
+    if (shipTypes[shipLength] <= 0) {
+        return PlacementResult{PlacementResult::QUOTA_EXCEEDED, shipLength};
+    }
 
-    // Add the new ship to the grid
-    ships.push_back(ship);
-    return true;
+    // Check if the new ship touches or overlaps any existing ship
+    if (ship.occupiedMask(rules).intersects(blockedCells)) {
+        return PlacementResult{PlacementResult::TOUCHING, shipLength};
+    }
+    return result;
 }
 
 /**
  * @brief Default constructor to initialize the OwnGrid object.
  *
- * @details Initializes the grid with default values and the ship types with
- *          predefined values.
+ * @details Initializes the grid with the standard rules: 10x10 cells, one
+ *          carrier ship, two battleships, three destroyers and four
+ *          submarines.
  */
-OwnGrid::OwnGrid() {
-    rows = 0;
-    columns = 0;
-    shipTypes = {
-        {5, 1},  // Carrier ship (1)
-        {4, 2},  // Battleship (2)
-        {3, 3},  // Destroyer (3)
-        {2, 4}   // Submarine (4)
-    };
+OwnGrid::OwnGrid() : OwnGrid{STANDARD_RULES} {
 }
 
 /**
@@ -142,19 +206,47 @@ OwnGrid::OwnGrid() {
  * @param rows The number of rows in the grid.
  * @param columns The number of columns in the grid.
  */
-OwnGrid::OwnGrid(int rows, int columns) : rows{rows}, columns{columns},
-		shipTypes{
-    {5, 1}, {4, 2}, {3, 3}, {2, 4}
-} {}
+OwnGrid::OwnGrid(int rows, int columns)
+    : OwnGrid{RuleSet{rows, columns, STANDARD_RULES.getQuotas(),
+		STANDARD_RULES.mayShipsTouch()}} {
+}
+
+/**
+ * @brief Constructor to initialize the OwnGrid with a rule set.
+ *
+ * @param rules The board dimensions, fleet and touching rule.
+ * @throws std::invalid_argument if the rule set is not valid.
+ */
+OwnGrid::OwnGrid(const RuleSet& rules) : rules{rules},
+		shipTypes{rules.getQuotas()}, hash{0} {
+    if (rules.isValid() == false) {
+        throw invalid_argument("OwnGrid: rule set is not valid");
+    }
+    cellShips.fill(NO_SHIP);
+
+    // Room for placing the fleet and shooting every cell once
+    ships.reserve(rules.getFleetSize());
+    shipHits.reserve(rules.getFleetSize());
+    journal.reserve(rules.getFleetSize() + rules.getCells());
+    journalPosition = 0;
+}
 
 /**
  * @brief Getter method to retrieve the set of shot positions.
  *
- * @return A constant reference to the set of positions where shots have been
- *         taken.
+ * @return The set of positions where shots have been taken.
+ */
+std::set<GridPosition> OwnGrid::getShotAt() const {
+    return shotMask.toPositions(rules.getColumns());
+}
+
+/**
+ * @brief Getter method to retrieve the cells where shots have been taken.
+ *
+ * @return The shot cells as a bit mask.
  */
-const std::set<GridPosition>& OwnGrid::getShotAt() const {
-    return shotAt;
+Bitboard OwnGrid::getShotMask() const {
+    return shotMask;
 }
 
 /**
@@ -166,32 +258,162 @@ const std::set<GridPosition>& OwnGrid::getShotAt() const {
 Shot::Impact OwnGrid::takeBlow(const Shot &shot) {
     GridPosition target = shot.getTargetPosition();  // Get the target position
 
-    // Iterate over all ships to check if the target position is a hit
-    for (const auto& ship : ships) {
-        set<GridPosition> shipOccupiedPositions = ship.occupiedArea();
+    // Shots outside the grid can't hit anything
+    if (target.isInside(rules.getRows(), rules.getColumns()) == false) {
+        return Shot::Impact::NONE;
+    }
+
+    return takeBlow(CellIndex::fromPosition(target, rules.getColumns()));
+}
+
+/**
+ * @brief Method to take a shot at a cell and determine the impact.
+ *
+ * @param target The cell that is shot; must be on the grid.
+ * @return The impact of the shot (HIT, SUNKEN, or NONE).
+ */
+Shot::Impact OwnGrid::takeBlow(CellIndex target) {
+    JournalEntry entry;
+    entry.target = target;
+    entry.isNewShot = shotMask.test(target) == false;
+    record(entry);
 
-        // If the target is within this ship's occupied positions, it's a hit
-        if (shipOccupiedPositions.find(target) != shipOccupiedPositions.end()){
-            shotAt.insert(target);  // Add the shot to the list of shots taken
+    return applyBlow(target, entry.isNewShot);
+}
+
+/**
+ * @brief Method to take a shot at a cell that can't be undone.
+ *
+ * @param target The cell that is shot; must be on the grid.
+ * @return The impact of the shot (HIT, SUNKEN, or NONE).
+ */
+Shot::Impact OwnGrid::takeBlowUnjournaled(CellIndex target) {
+    return applyBlow(target, shotMask.test(target) == false);
+}
 
-            // Check if all parts of the ship are hit
-            set<GridPosition> setIntersection;
-            set_intersection(shipOccupiedPositions.begin(),
-            				shipOccupiedPositions.end(),
-                            shotAt.begin(),
-							shotAt.end(),
-                            inserter(setIntersection, setIntersection.begin()));
+/**
+ * @brief Marks a cell as shot and updates the hit count of its ship.
+ *
+ * @param target The cell that is shot.
+ * @param isNewShot True if the cell was not shot before.
+ * @return The impact of the shot.
+ */
+Shot::Impact OwnGrid::applyBlow(CellIndex target, bool isNewShot) {
+    shotMask |= Bitboard::cell(target);
+    if (isNewShot) {
+        hash ^= ZOBRIST.cellKey(target.value(), SHOT_CODE);
+    }
 
-            // If the whole ship is hit, it's sunken
-            if (setIntersection.size() == shipOccupiedPositions.size()) {
-                return Shot::Impact::SUNKEN;  // Ship is sunken
-            }
+    // Look up the ship at the target position, if any
+    int shipId = shipIdAt(target);
+    if (shipId != NO_SHIP) {
+        // Count every cell of the ship only once
+        if (isNewShot) {
+            shipHits[shipId]++;
+        }
 
-            return Shot::Impact::HIT;  // It's a hit but not sunken
+        // If the whole ship is hit, it's sunken
+        if (shipHits[shipId] == ships[shipId].length()) {
+            return Shot::Impact::SUNKEN;  // Ship is sunken
         }
+
+        return Shot::Impact::HIT;  // It's a hit but not sunken
     }
 
-    // If no ship is hit, record the shot and return NONE
-    shotAt.insert(target);
+    // If no ship is hit, the shot is a miss
     return Shot::Impact::NONE;
 }
+
+/**
+ * @brief Appends a mutation to the journal, dropping undone entries.
+ *
+ * @param entry The mutation to record.
+ */
+void OwnGrid::record(const JournalEntry &entry) {
+    journal.resize(journalPosition);
+    journal.push_back(entry);
+    journalPosition++;
+}
+
+/**
+ * @brief Method to revert the most recent placeShip() or takeBlow().
+ *
+ * @return true if a move was reverted, false if there is none.
+ */
+bool OwnGrid::undo() {
+    if (canUndo() == false) {
+        return false;
+    }
+    const JournalEntry& entry = journal[--journalPosition];
+    if (entry.isPlacement) {
+        revertPlacement(entry);
+    } else if (entry.isNewShot) {
+        // Repeated shots changed nothing, new ones are taken back
+        shotMask &= ~Bitboard::cell(entry.target);
+        hash ^= ZOBRIST.cellKey(entry.target.value(), SHOT_CODE);
+        int shipId = shipIdAt(entry.target);
+        if (shipId != NO_SHIP) {
+            shipHits[shipId]--;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Method to re-apply the most recently undone move.
+ *
+ * @return true if a move was re-applied, false if there is none.
+ */
+bool OwnGrid::redo() {
+    if (canRedo() == false) {
+        return false;
+    }
+    const JournalEntry& entry = journal[journalPosition++];
+    if (entry.isPlacement) {
+        applyPlacement(entry.ship);
+    } else {
+        applyBlow(entry.target, entry.isNewShot);
+    }
+    return true;
+}
+
+/**
+ * @brief Method to check whether a move can be undone.
+ *
+ * @return true if undo() would revert a move.
+ */
+bool OwnGrid::canUndo() const {
+    return journalPosition > 0;
+}
+
+/**
+ * @brief Method to check whether a move can be redone.
+ *
+ * @return true if redo() would re-apply a move.
+ */
+bool OwnGrid::canRedo() const {
+    return journalPosition < journal.size();
+}
+
+/**
+ * @brief Method to forget all journaled moves, keeping the current state.
+ */
+void OwnGrid::clearJournal() {
+    journal.clear();
+    journalPosition = 0;
+}
+
+/**
+ * @brief Method to return to the empty grid of the same rules.
+ */
+void OwnGrid::reset() {
+    ships.clear();
+    shipTypes = rules.getQuotas();
+    shotMask = Bitboard{};
+    blockedCells = Bitboard{};
+    occupiedCells = Bitboard{};
+    shipHits.clear();
+    cellShips.fill(NO_SHIP);
+    hash = 0;
+    clearJournal();
+}
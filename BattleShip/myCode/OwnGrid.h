@@ -18,10 +18,12 @@
 #ifndef OWNGRID_H_
 #define OWNGRID_H_
 
+#include "RuleSet.h"
 #include "Ship.h"
 #include "Shot.h"
+#include <array>
+#include <cstdint>
 #include <vector>
-#include <map>
 #include <set>
 
 /**
@@ -34,27 +36,108 @@
  *          such as the ship positions and shot positions.
  */
 class OwnGrid {
+public:
+    static constexpr int NO_SHIP = -1; /**< Ship id of cells without ship. */
+
 private:
-    int rows; /**< The number of rows in the grid. */
-    int columns; /**< The number of columns in the grid. */
+    RuleSet rules; /**< Board dimensions, fleet and touching rule. */
     std::vector<Ship> ships; /**< Vector to store ships placed on the grid. */
-    std::map<int, int> shipTypes; /**< Map to store the count of
-    								  each ship type. */
-    std::set<GridPosition> shotAt; /**< Set to store the positions where shots
-                                       were taken. */
+    RuleSet::Quota shipTypes; /**< Number of ships of each length that can
+                                  still be placed, indexed by length. */
+    Bitboard shotMask; /**< Cells of the grid where shots were taken. */
+    Bitboard blockedCells; /**< Cells occupied or touched by any placed ship;
+                               new ships must not cover them. */
+    Bitboard occupiedCells; /**< Cells occupied by any placed ship. */
+    std::vector<int> shipHits; /**< Number of distinct cells of each ship
+                                   that were hit, in the same order as ships. */
+    std::array<signed char, Bitboard::CAPACITY> cellShips; /**< Index in ships
+                                   of the ship on each cell, or NO_SHIP. */
+    std::uint64_t hash; /**< Zobrist hash of the placed ships and the shot
+                            cells. */
+
+    /**
+     * @struct JournalEntry
+     * @brief The change made by one placeShip() or takeBlow() call.
+     */
+    struct JournalEntry {
+        bool isPlacement = false; /**< True for placeShip(), false for
+                                      takeBlow(). */
+        bool isNewShot = false; /**< takeBlow(): the cell was not shot
+                                    before. */
+        CellIndex target; /**< takeBlow(): the cell that was shot. */
+        Ship ship{GridPosition{'A', 1}, GridPosition{'A', 1}}; /**<
+                                    placeShip(): the placed ship. */
+        Bitboard previousBlocked; /**< placeShip(): blockedCells before. */
+    };
+    std::vector<JournalEntry> journal; /**< Mutations in the order they were
+                                           made, including undone ones. */
+    std::size_t journalPosition; /**< Number of entries in journal that are
+                                     currently applied. */
+
+    /**
+     * @brief Adds a ship to all data structures without validating it.
+     *
+     * @param ship The ship to add; must be a valid placement.
+     */
+    void applyPlacement(const Ship& ship);
+
+    /**
+     * @brief Recomputes the hash from the ships and the shot cells.
+     */
+    void rehash();
+
+    /**
+     * @brief Removes the most recently placed ship.
+     *
+     * @param entry The journal entry of that placement.
+     */
+    void revertPlacement(const JournalEntry& entry);
+
+    /**
+     * @brief Marks a cell as shot and updates the hit count of its ship.
+     *
+     * @param target The cell that is shot.
+     * @param isNewShot True if the cell was not shot before.
+     * @return The impact of the shot.
+     */
+    Shot::Impact applyBlow(CellIndex target, bool isNewShot);
+
+    /**
+     * @brief Appends a mutation to the journal, dropping undone entries.
+     *
+     * @param entry The mutation to record.
+     */
+    void record(const JournalEntry& entry);
+
+    /// Restores grids from bit planes without replaying their history.
+    friend class BoardCheckpoint;
+    /// Shares grids between snapshots that only differ in their shots.
+    friend class SharedBoard;
 
 public:
     /**
      * @brief Default constructor for the OwnGrid class.
      *
-     * @details Initializes the grid with default values.
+     * @details Initializes the grid with the standard rules.
      */
     OwnGrid();
 
+    /**
+     * @brief Constructor to initialize the OwnGrid with a rule set.
+     *
+     * @param rules The board dimensions, fleet and touching rule.
+     * @throws std::invalid_argument if the rule set is not valid (see
+     *         RuleSet::isValid()).
+     */
+    explicit OwnGrid(const RuleSet& rules);
+
     /**
      * @brief Constructor to initialize the OwnGrid with specified rows and
      *        columns.
      *
+     * @details Uses the fleet and touching rule of the standard rules. The
+     *          grid may have at most Bitboard::CAPACITY cells.
+     *
      * @param rows The number of rows in the grid.
      * @param columns The number of columns in the grid.
      */
@@ -74,6 +157,13 @@ public:
      */
     int getRows() const;
 
+    /**
+     * @brief Getter method to retrieve the rules of the grid.
+     *
+     * @return A constant reference to the rule set.
+     */
+    const RuleSet& getRules() const;
+
     /**
      * @brief Method to place a ship on the grid.
      *
@@ -82,6 +172,29 @@ public:
      */
     bool placeShip(const Ship& ship);
 
+    /**
+     * @brief Method to place a ship on the grid, reporting why it failed.
+     *
+     * @details Does not write to the console; print the result if a message
+     *          is wanted.
+     *
+     * @param ship The ship to be placed on the grid.
+     * @return VALID if the ship was placed, otherwise the reason it was not.
+     */
+    PlacementResult tryPlaceShip(const Ship& ship);
+
+    /**
+     * @brief Method to check whether a ship could be placed on the grid.
+     *
+     * @details Checks the ship itself (see Ship::validate()), that it lies
+     *          within the grid's rows and columns, that ships of its length
+     *          are still available and that it does not touch a placed ship.
+     *
+     * @param ship The ship to check.
+     * @return VALID if the ship can be placed, otherwise the reason it can't.
+     */
+    PlacementResult validatePlacement(const Ship& ship) const;
+
     /**
      * @brief Getter method to retrieve all the ships placed on the grid.
      *
@@ -89,22 +202,141 @@ public:
      */
     const std::vector<Ship>& getShips() const;
 
+    /**
+     * @brief Method to find the ship on a cell.
+     *
+     * @param position The position to look up.
+     * @return The index of the ship in getShips(), or NO_SHIP if the cell is
+     *         water or outside the grid.
+     */
+    int shipIdAt(const GridPosition& position) const;
+
+    /**
+     * @brief Method to find the ship on a cell.
+     *
+     * @param cell The linear index of the cell; must be on the grid.
+     * @return The index of the ship in getShips(), or NO_SHIP.
+     */
+    int shipIdAt(CellIndex cell) const {
+        return cellShips[cell.value()];
+    }
+
     /**
      * @brief Method to take a shot at the grid and determine the impact.
      *
+     * @details Shots outside the grid are misses and are not recorded.
+     *
      * @param shot The shot to be taken at the grid.
      * @return The impact result of the shot.
      */
     Shot::Impact takeBlow(const Shot& shot);
 
+    /**
+     * @brief Method to take a shot at a cell and determine the impact.
+     *
+     * @param target The cell that is shot; must be on the grid.
+     * @return The impact result of the shot.
+     */
+    Shot::Impact takeBlow(CellIndex target);
+
+    /**
+     * @brief Method to take a shot at a cell that can't be undone.
+     *
+     * @details Skips the journal entry of takeBlow(), for callers such as
+     *          MatchEngine that never undo. Journaled moves before it must
+     *          not be undone either; clear the journal first.
+     *
+     * @param target The cell that is shot; must be on the grid.
+     * @return The impact result of the shot.
+     */
+    Shot::Impact takeBlowUnjournaled(CellIndex target);
+
     /**
      * @brief Getter method to retrieve all the positions where shots have
      *        been taken.
      *
-     * @return A constant reference to the set of positions where shots
-     *         have been taken.
+     * @details Built from getShotMask() on every call; use the mask on hot
+     *          paths.
+     *
+     * @return The set of positions on the grid where shots have been taken.
+     */
+    std::set<GridPosition> getShotAt() const;
+
+    /**
+     * @brief Getter method to retrieve the cells where shots have been taken.
+     *
+     * @return The shot cells as a bit mask.
+     */
+    Bitboard getShotMask() const;
+
+    /**
+     * @brief Method to check whether every placed ship is sunk.
+     *
+     * @return true if ships were placed and all their cells were shot.
+     */
+    bool allShipsSunk() const {
+        return occupiedCells.any() && occupiedCells.isSubsetOf(shotMask);
+    }
+
+    /**
+     * @brief Getter method to retrieve the Zobrist hash of the grid.
+     *
+     * @details Grids with the same rules, ships and shot cells have the same
+     *          hash, whatever the order of the moves. The hash is updated
+     *          with every move; the empty grid has hash 0.
+     *
+     * @return The hash of the current state.
+     */
+    std::uint64_t getHash() const {
+        return hash;
+    }
+
+    /**
+     * @brief Method to revert the most recent placeShip() or takeBlow().
+     *
+     * @details Only successful placements and shots on the grid are
+     *          journaled. Undo and redo cost constant time per move (plus the
+     *          ship length for placements) and do not allocate memory.
+     *
+     * @return true if a move was reverted, false if there is none.
+     */
+    bool undo();
+
+    /**
+     * @brief Method to re-apply the most recently undone move.
+     *
+     * @details A new placeShip() or takeBlow() discards all undone moves.
+     *
+     * @return true if a move was re-applied, false if there is none.
+     */
+    bool redo();
+
+    /**
+     * @brief Method to check whether a move can be undone.
+     *
+     * @return true if undo() would revert a move.
+     */
+    bool canUndo() const;
+
+    /**
+     * @brief Method to check whether a move can be redone.
+     *
+     * @return true if redo() would re-apply a move.
+     */
+    bool canRedo() const;
+
+    /**
+     * @brief Method to forget all journaled moves, keeping the current state.
+     */
+    void clearJournal();
+
+    /**
+     * @brief Method to return to the empty grid of the same rules.
+     *
+     * @details Ships, shots and the journal are removed, but the memory
+     *          reserved for them is kept for the next game.
      */
-    const std::set<GridPosition>& getShotAt() const;
+    void reset();
 };
 
 #endif /* OWNGRID_H_ */
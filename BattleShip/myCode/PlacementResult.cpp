@@ -0,0 +1,72 @@
+/**
+ * @file PlacementResult.cpp
+ * @brief Implementation file for the PlacementResult class and its console
+ *        formatter.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "PlacementResult.h"
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Returns the name of the ship type of a given length.
+ *
+ * @param length The ship length.
+ * @return The name of the ship type.
+ */
+const char* PlacementResult::shipTypeName(int length) {
+    switch (length) {
+    case 5:
+        return "carrier ship";
+    case 4:
+        return "battleship";
+    case 3:
+        return "destroyer ship";
+    case 2:
+        return "submarine";
+    default:
+        return "ship";
+    }
+}
+
+/**
+ * @brief Overloads the << operator to print the console message that
+ *        describes a placement result.
+ *
+ * @param lhs Output stream to which the message is written.
+ * @param rhs The result to describe.
+ * @return Reference to the output stream.
+ */
+ostream& operator<<(ostream& lhs, const PlacementResult& rhs) {
+    switch (rhs.getStatus()) {
+    case PlacementResult::VALID:
+        lhs << "Placed " << PlacementResult::shipTypeName(rhs.getShipLength())
+                << " of length " << rhs.getShipLength();
+        break;
+    case PlacementResult::OUT_OF_BOUNDS:
+        lhs << "Ship is out of grid boundaries";
+        break;
+    case PlacementResult::BAD_LENGTH:
+        lhs << "Ship length is not between 2 or 5";
+        break;
+    case PlacementResult::NOT_STRAIGHT:
+        lhs << "Field occupied by ship is not in a straight line";
+        break;
+    case PlacementResult::QUOTA_EXCEEDED:
+        lhs << "No more " << PlacementResult::shipTypeName(
+                rhs.getShipLength()) << "s of length " << rhs.getShipLength()
+                << " can be placed. Ship quantity exceeds";
+        break;
+    case PlacementResult::TOUCHING:
+        lhs << "Ships are touching each other";
+        break;
+    }
+    return lhs;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file PlacementResult.h
+ * @brief Header file for the PlacementResult class, the outcome of validating
+ *        a ship or placing it on a grid.
+ *
+ * @details Ship::validate() and OwnGrid::tryPlaceShip() return this type
+ *          instead of printing to the console, so that millions of candidate
+ *          placements can be checked quietly. Callers that want the familiar
+ *          console messages print the result with operator<<.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef PLACEMENTRESULT_H_
+#define PLACEMENTRESULT_H_
+
+#include <iosfwd>
+
+/**
+ * @class PlacementResult
+ * @brief Status of a ship validation together with the ship's length.
+ */
+class PlacementResult {
+public:
+    /**
+     * @enum Status
+     * @brief Enum to represent why a ship can or cannot be placed.
+     *
+     * - VALID: The ship can be placed.
+     * - OUT_OF_BOUNDS: Bow or stern lie outside the grid.
+     * - BAD_LENGTH: The ship is shorter or longer than allowed.
+     * - NOT_STRAIGHT: Bow and stern are neither in one row nor one column.
+     * - QUOTA_EXCEEDED: All ships of this length are already placed.
+     * - TOUCHING: The ship overlaps or touches a ship already placed.
+     */
+    enum Status {
+        VALID,          /**< Ship can be placed */
+        OUT_OF_BOUNDS,  /**< Ship leaves the grid */
+        BAD_LENGTH,     /**< Ship length not allowed */
+        NOT_STRAIGHT,   /**< Ship is neither horizontal nor vertical */
+        QUOTA_EXCEEDED, /**< No more ships of this length allowed */
+        TOUCHING        /**< Ship touches another ship */
+    };
+
+private:
+    Status status;   ///< Outcome of the validation.
+    int shipLength;  ///< Length of the validated ship, -1 if not straight.
+
+public:
+    /**
+     * @brief Constructor to initialize the result.
+     * @param status Outcome of the validation.
+     * @param shipLength Length of the validated ship.
+     */
+    constexpr PlacementResult(Status status, int shipLength)
+        : status{status}, shipLength{shipLength} {}
+
+    /**
+     * @brief Getter method to retrieve the outcome of the validation.
+     * @return The status.
+     */
+    constexpr Status getStatus() const {
+        return status;
+    }
+
+    /**
+     * @brief Getter method to retrieve the length of the validated ship.
+     * @return The ship length, -1 if the ship is not straight.
+     */
+    constexpr int getShipLength() const {
+        return shipLength;
+    }
+
+    /**
+     * @brief Checks whether the ship can be placed.
+     * @return True if the status is VALID.
+     */
+    constexpr bool isValid() const {
+        return status == VALID;
+    }
+
+    /**
+     * @brief Returns the name of the ship type of a given length.
+     * @param length The ship length.
+     * @return "carrier ship", "battleship", "destroyer ship", "submarine" or
+     *         "ship" for other lengths.
+     */
+    static const char* shipTypeName(int length);
+};
+
+/**
+ * @brief Overloads the << operator to print the console message that
+ *        describes a placement result.
+ * @param lhs Output stream to which the message is written.
+ * @param rhs The result to describe.
+ * @return Reference to the output stream.
+ */
+std::ostream& operator<<(std::ostream& lhs, const PlacementResult& rhs);
+
+#endif /* PLACEMENTRESULT_H_ */
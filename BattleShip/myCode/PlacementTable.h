@@ -0,0 +1,268 @@
+/**
+ * @file PlacementTable.h
+ * @brief Header file for the PlacementTable class, the list of every legal
+ *        ship placement on a grid together with its bit masks.
+ *
+ * @details For each ship length, orientation and origin (top-left cell) the
+ *          table stores the occupied and the blocked cells as Bitboards.
+ *          Overlap and touching checks between a candidate placement and the
+ *          ships already on a grid are then single AND operations. The table
+ *          is built by a constexpr constructor from a RuleSet, so the table
+ *          of the standard rules (STANDARD_PLACEMENTS) is generated by the
+ *          compiler while tables of house rules are built at runtime.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef PLACEMENTTABLE_H_
+#define PLACEMENTTABLE_H_
+
+#include "Bitboard.h"
+#include "RuleSet.h"
+#include "Ship.h"
+#include <array>
+
+/**
+ * @struct Placement
+ * @brief One legal position of a ship on the grid.
+ */
+struct Placement {
+    Bitboard occupied;  ///< Cells covered by the ship.
+    Bitboard blocked;   ///< Covered cells plus their 8-neighbourhood, or only
+                        ///< the covered cells if ships may touch.
+    unsigned char rowIndex = 0;    ///< Zero based row of the top-left cell.
+    unsigned char columnIndex = 0; ///< Zero based column of the top-left cell.
+    unsigned char length = 0;      ///< Number of cells covered.
+    bool vertical = false;         ///< True if the ship extends downwards.
+
+    /**
+     * @brief Converts the placement to a Ship with the bow at the top-left.
+     * @return The ship covering the placement's cells.
+     */
+    Ship toShip() const {
+        GridPosition bow{char('A' + rowIndex), columnIndex + 1};
+        GridPosition stern = vertical
+                ? GridPosition{char('A' + rowIndex + length - 1),
+                        columnIndex + 1}
+                : GridPosition{char('A' + rowIndex), columnIndex + length};
+        return Ship{bow, stern};
+    }
+};
+
+/**
+ * @class PlacementTable
+ * @brief All placements of ships of length Ship::MIN_LENGTH to
+ *        Ship::MAX_LENGTH on a grid of up to Bitboard::CAPACITY cells.
+ *
+ * @details Placements are ordered by length, then horizontal before
+ *          vertical, then by origin in row-major order. The index of a
+ *          placement can therefore be computed directly (see indexOf()).
+ */
+class PlacementTable {
+public:
+    /**
+     * @brief Upper bound of the number of placements. A grid of n cells has
+     *        fewer than 2 * n placements per length.
+     */
+    static constexpr int MAX_PLACEMENTS = 2 * Bitboard::CAPACITY
+            * (Ship::MAX_LENGTH - Ship::MIN_LENGTH + 1);
+
+private:
+    int rows;    ///< The number of rows of the grid.
+    int columns; ///< The number of columns of the grid.
+    bool shipsMayTouch; ///< True if blocked masks contain no neighbours.
+    int placementCount; ///< Number of used entries in placements.
+    /// Index of the first placement of each length; entry length + 1 ends it.
+    std::array<int, Ship::MAX_LENGTH + 2> firstOfLength;
+    std::array<Placement, MAX_PLACEMENTS> placements; ///< The placements.
+
+    /**
+     * @brief Builds the mask of a rectangle of cells, clipped to the grid.
+     * @param firstRow First zero based row, may lie outside the grid.
+     * @param lastRow Last zero based row, may lie outside the grid.
+     * @param firstColumn First zero based column, may lie outside the grid.
+     * @param lastColumn Last zero based column, may lie outside the grid.
+     * @return The cells of the rectangle that are on the grid.
+     */
+    constexpr Bitboard rectangle(int firstRow, int lastRow, int firstColumn,
+            int lastColumn) const {
+        Bitboard mask;
+        for (int rowIndex = firstRow; rowIndex <= lastRow; rowIndex++) {
+            for (int columnIndex = firstColumn; columnIndex <= lastColumn;
+                    columnIndex++) {
+                if (rowIndex >= 0 && rowIndex < rows && columnIndex >= 0
+                        && columnIndex < columns) {
+                    mask |= Bitboard::cell(CellIndex::fromRowColumn(rowIndex,
+                            columnIndex, columns));
+                }
+            }
+        }
+        return mask;
+    }
+
+    /**
+     * @brief Appends one placement to the table.
+     * @param rowIndex Zero based row of the top-left cell.
+     * @param columnIndex Zero based column of the top-left cell.
+     * @param length Length of the ship.
+     * @param vertical True if the ship extends downwards.
+     */
+    constexpr void add(int rowIndex, int columnIndex, int length,
+            bool vertical) {
+        int lastRow = vertical ? rowIndex + length - 1 : rowIndex;
+        int lastColumn = vertical ? columnIndex : columnIndex + length - 1;
+        Placement& placement = placements[placementCount++];
+        placement.occupied = rectangle(rowIndex, lastRow, columnIndex,
+                lastColumn);
+        placement.blocked = shipsMayTouch ? placement.occupied
+                : rectangle(rowIndex - 1, lastRow + 1, columnIndex - 1,
+                        lastColumn + 1);
+        placement.rowIndex = static_cast<unsigned char>(rowIndex);
+        placement.columnIndex = static_cast<unsigned char>(columnIndex);
+        placement.length = static_cast<unsigned char>(length);
+        placement.vertical = vertical;
+    }
+
+public:
+    /**
+     * @brief Constructor to generate all placements of a board.
+     * @details The rule set must be valid (see RuleSet::isValid()). All
+     *          lengths from Ship::MIN_LENGTH to Ship::MAX_LENGTH are listed,
+     *          whether or not the fleet contains them.
+     * @param rules The rules that define the board and touching rule.
+     */
+    constexpr explicit PlacementTable(const RuleSet& rules)
+        : rows{rules.getRows()}, columns{rules.getColumns()},
+          shipsMayTouch{rules.mayShipsTouch()}, placementCount{0},
+          firstOfLength{}, placements{} {
+        for (int length = 0; length <= Ship::MIN_LENGTH; length++) {
+            firstOfLength[length] = 0;
+        }
+        for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+                length++) {
+            firstOfLength[length] = placementCount;
+            for (int rowIndex = 0; rowIndex < rows; rowIndex++) {
+                for (int columnIndex = 0; columnIndex + length <= columns;
+                        columnIndex++) {
+                    add(rowIndex, columnIndex, length, false);
+                }
+            }
+            for (int rowIndex = 0; rowIndex + length <= rows; rowIndex++) {
+                for (int columnIndex = 0; columnIndex < columns;
+                        columnIndex++) {
+                    add(rowIndex, columnIndex, length, true);
+                }
+            }
+        }
+        firstOfLength[Ship::MAX_LENGTH + 1] = placementCount;
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of rows of the grid.
+     * @return The number of rows.
+     */
+    constexpr int getRows() const {
+        return rows;
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of columns of the grid.
+     * @return The number of columns.
+     */
+    constexpr int getColumns() const {
+        return columns;
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of placements.
+     * @return The number of placements of all lengths.
+     */
+    constexpr int size() const {
+        return placementCount;
+    }
+
+    /**
+     * @brief Index of the first placement of a ship length.
+     * @param length A length between Ship::MIN_LENGTH and Ship::MAX_LENGTH.
+     * @return The index of the first placement of that length.
+     */
+    constexpr int begin(int length) const {
+        return firstOfLength[length];
+    }
+
+    /**
+     * @brief Index one past the last placement of a ship length.
+     * @param length A length between Ship::MIN_LENGTH and Ship::MAX_LENGTH.
+     * @return The index after the last placement of that length.
+     */
+    constexpr int end(int length) const {
+        return firstOfLength[length + 1];
+    }
+
+    /**
+     * @brief Getter method to retrieve one placement.
+     * @param index Index between 0 and size() - 1.
+     * @return A constant reference to the placement.
+     */
+    constexpr const Placement& operator[](int index) const {
+        return placements[index];
+    }
+
+    /**
+     * @brief Computes the index of a placement from its parameters.
+     * @param rowIndex Zero based row of the top-left cell.
+     * @param columnIndex Zero based column of the top-left cell.
+     * @param length Length of the ship.
+     * @param vertical True if the ship extends downwards.
+     * @return The index of the placement, or -1 if it does not fit.
+     */
+    constexpr int indexOf(int rowIndex, int columnIndex, int length,
+            bool vertical) const {
+        if (length < Ship::MIN_LENGTH || length > Ship::MAX_LENGTH
+                || rowIndex < 0 || columnIndex < 0) {
+            return -1;
+        }
+        int horizontalColumns = columns - length + 1;
+        if (!vertical) {
+            if (rowIndex >= rows || columnIndex >= horizontalColumns) {
+                return -1;
+            }
+            return firstOfLength[length] + rowIndex * horizontalColumns
+                    + columnIndex;
+        }
+        if (rowIndex + length > rows || columnIndex >= columns) {
+            return -1;
+        }
+        return firstOfLength[length] + rows * horizontalColumns
+                + rowIndex * columns + columnIndex;
+    }
+
+    /**
+     * @brief Finds the placement covering the same cells as a ship.
+     * @param ship The ship to look up.
+     * @return The index of the placement, or -1 if the ship is not a legal
+     *         placement on this grid.
+     */
+    int indexOf(const Ship& ship) const {
+        GridPosition bow = ship.getBow();
+        GridPosition stern = ship.getStern();
+        int rowIndex = (bow.getRow() < stern.getRow() ? bow.getRow()
+                : stern.getRow()) - 'A';
+        int columnIndex = (bow.getColumn() < stern.getColumn()
+                ? bow.getColumn() : stern.getColumn()) - 1;
+        bool vertical = bow.getColumn() == stern.getColumn()
+                && bow.getRow() != stern.getRow();
+        return indexOf(rowIndex, columnIndex, ship.length(), vertical);
+    }
+};
+
+/**
+ * @brief Placement table of the standard rules, generated at compile time.
+ */
+inline constexpr PlacementTable STANDARD_PLACEMENTS{STANDARD_RULES};
+
+#endif /* PLACEMENTTABLE_H_ */
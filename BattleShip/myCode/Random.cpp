@@ -0,0 +1,38 @@
+/**
+ * @file Random.cpp
+ * @brief Implementation file for the Random class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "Random.h"
+
+using namespace std;
+
+/**
+ * @brief Constructor to seed the generator.
+ *
+ * @param seed Any value; equal seeds give equal sequences.
+ */
+Random::Random(uint64_t seed) {
+    this->seed(seed);
+}
+
+/**
+ * @brief Restarts the generator from a seed.
+ *
+ * @details Expands the seed with splitmix64, which never yields an all zero
+ *          state.
+ *
+ * @param seed Any value; equal seeds give equal sequences.
+ */
+void Random::seed(uint64_t seed) {
+    for (uint64_t& word : state) {
+        word = mix(seed);
+        seed += 0x9e3779b97f4a7c15;
+    }
+}
@@ -0,0 +1,190 @@
+/**
+ * @file Random.h
+ * @brief Header file for the Random class, a small and fast pseudo random
+ *        number generator for simulations.
+ *
+ * @details Implements xoshiro256** by Blackman and Vigna. The state is seeded
+ *          from a single 64 bit value with splitmix64, so equal seeds give
+ *          equal sequences on every platform, unlike the distributions of
+ *          <random>. The class satisfies UniformRandomBitGenerator and can
+ *          be passed to the standard algorithms.
+ *
+ *          Parallel simulations do not share or hand on generators: every
+ *          unit of work derives its own stream from the run's seed, the
+ *          number of the game (or task) and a purpose with stream(). A
+ *          stream only depends on these three values, so a single game of a
+ *          large run can be played again on its own, whatever thread played
+ *          it first.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef RANDOM_H_
+#define RANDOM_H_
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @class Random
+ * @brief Deterministic xoshiro256** generator.
+ */
+class Random {
+public:
+    using result_type = std::uint64_t; ///< Type of the generated values.
+
+    /**
+     * @enum Purpose
+     * @brief What a stream of a game is used for.
+     *
+     * @details Streams of different purposes are independent even for the
+     *          same seed and game. Other values may be used for purposes
+     *          not listed here.
+     */
+    enum Purpose : std::uint64_t {
+        FIRST_PLAYER,  /**< Decisions of the player who shoots first. */
+        SECOND_PLAYER, /**< Decisions of the other player. */
+        SAMPLING       /**< Monte Carlo samples, e.g. of FleetSampler. */
+    };
+
+private:
+    std::array<std::uint64_t, 4> state; ///< The generator state, never all 0.
+
+    /**
+     * @brief Rotates a word to the left.
+     * @param word The word to rotate.
+     * @param bits Number of bits, between 1 and 63.
+     * @return The rotated word.
+     */
+    static std::uint64_t rotateLeft(std::uint64_t word, int bits) {
+        return (word << bits) | (word >> (64 - bits));
+    }
+
+    /**
+     * @brief Scrambles a number with splitmix64.
+     * @param value The number.
+     * @return A well mixed 64 bit value; different numbers never collide.
+     */
+    static constexpr std::uint64_t mix(std::uint64_t value) {
+        value += 0x9e3779b97f4a7c15;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+        return value ^ (value >> 31);
+    }
+
+public:
+    /**
+     * @brief Constructor to seed the generator.
+     * @param seed Any value; equal seeds give equal sequences.
+     */
+    explicit Random(std::uint64_t seed = 0);
+
+    /**
+     * @brief Restarts the generator from a seed.
+     * @param seed Any value; equal seeds give equal sequences.
+     */
+    void seed(std::uint64_t seed);
+
+    /**
+     * @brief Derives the seed of a stream.
+     * @details Each step is a bijection, so for one seed and purpose all
+     *          games get different seeds, unlike seed + game, whose streams
+     *          overlap those of seed + 1.
+     * @param seed Seed of the whole run.
+     * @param game Number of the game, task or other unit of work.
+     * @param purpose What the stream is used for, e.g. a Purpose.
+     * @return The seed for seed().
+     */
+    static constexpr std::uint64_t streamSeed(std::uint64_t seed,
+            std::uint64_t game, std::uint64_t purpose) {
+        return mix(mix(mix(seed) ^ game) ^ purpose);
+    }
+
+    /**
+     * @brief Creates the generator of a stream.
+     * @param seed Seed of the whole run.
+     * @param game Number of the game, task or other unit of work.
+     * @param purpose What the stream is used for, e.g. a Purpose.
+     * @return A generator seeded with streamSeed(seed, game, purpose).
+     */
+    static Random stream(std::uint64_t seed, std::uint64_t game,
+            std::uint64_t purpose) {
+        return Random{streamSeed(seed, game, purpose)};
+    }
+
+    /**
+     * @brief Smallest value returned by next().
+     * @return 0.
+     */
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    /**
+     * @brief Largest value returned by next().
+     * @return The largest 64 bit value.
+     */
+    static constexpr result_type max() {
+        return ~result_type(0);
+    }
+
+    /**
+     * @brief Draws the next 64 random bits.
+     * @return A uniformly distributed 64 bit value.
+     */
+    std::uint64_t next() {
+        std::uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        std::uint64_t shifted = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotateLeft(state[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Draws the next 64 random bits (UniformRandomBitGenerator).
+     * @return A uniformly distributed 64 bit value.
+     */
+    result_type operator()() {
+        return next();
+    }
+
+    /**
+     * @brief Draws an integer below a bound.
+     * @details Uses Lemire's multiply and shift method with rejection, so
+     *          the result is exactly uniform without a division in the
+     *          common case.
+     * @param bound The exclusive upper bound, must be positive.
+     * @return A uniformly distributed value in [0, bound).
+     */
+    std::uint32_t below(std::uint32_t bound) {
+        std::uint64_t product = (next() >> 32) * bound;
+        std::uint32_t low = static_cast<std::uint32_t>(product);
+        if (low < bound) {
+            std::uint32_t threshold = static_cast<std::uint32_t>(-bound)
+                    % bound;
+            while (low < threshold) {
+                product = (next() >> 32) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    /**
+     * @brief Draws a real number between 0 and 1.
+     * @return A uniformly distributed value in [0, 1) with 53 random bits.
+     */
+    double uniform() {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+};
+
+#endif /* RANDOM_H_ */
@@ -0,0 +1,60 @@
+/**
+ * @file RandomStrategy.cpp
+ * @brief Implementation file for the RandomStrategy class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "RandomStrategy.h"
+
+using namespace std;
+
+/**
+ * @brief Constructor to create a strategy.
+ *
+ * @param random Source of all decisions; must outlive the strategy.
+ * @param rules The rules of the games.
+ * @param placement How the own fleet is placed.
+ * @throws std::invalid_argument if the rules are not valid.
+ */
+RandomStrategy::RandomStrategy(Random& random, const RuleSet& rules,
+        FleetGenerator::Policy placement) : fleets{rules, placement},
+        random{random} {
+}
+
+/**
+ * @brief Places the whole fleet on an empty grid.
+ *
+ * @param grid The empty grid.
+ * @return false if the fleet could not be placed.
+ */
+bool RandomStrategy::placeFleet(OwnGrid& grid) {
+    return fleets.fill(grid, random);
+}
+
+/**
+ * @brief Forgets the state of the fleet generator between games.
+ */
+void RandomStrategy::reset() {
+    fleets.reset();
+}
+
+/**
+ * @brief Chooses a random open cell.
+ *
+ * @param grid The results of the own shots so far.
+ * @return The target, or an off-grid index if no cell is open.
+ */
+CellIndex RandomStrategy::nextShot(const OpponentGrid& grid) {
+    Bitboard open = grid.getStateMask(OpponentGrid::UNKNOWN)
+            & ~grid.getWaterMask();
+    if (open.none()) {
+        return CellIndex{static_cast<uint16_t>(Bitboard::CAPACITY)};
+    }
+    return CellIndex{static_cast<uint16_t>(
+            open.nth(static_cast<int>(random.below(open.count()))))};
+}
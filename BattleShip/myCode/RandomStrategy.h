@@ -0,0 +1,76 @@
+/**
+ * @file RandomStrategy.h
+ * @brief Header file for the RandomStrategy class, which shoots at random
+ *        cells.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef RANDOMSTRATEGY_H_
+#define RANDOMSTRATEGY_H_
+
+#include "FleetGenerator.h"
+#include "Random.h"
+#include "Strategy.h"
+
+/**
+ * @class RandomStrategy
+ * @brief Strategy that shoots at a uniformly random open cell.
+ *
+ * @details Cells that were shot at or are known to be water are never
+ *          chosen. Apart from the given Random, the strategy only keeps the
+ *          Markov chain of a UNIFORM_CHAIN placement between games, which
+ *          reset() forgets; reseeding the Random after reset() repeats a
+ *          game.
+ */
+class RandomStrategy {
+private:
+    FleetGenerator fleets; ///< Places the own fleet.
+    Random& random;        ///< Source of all decisions.
+
+public:
+    /**
+     * @brief Constructor to create a strategy.
+     *
+     * @param random Source of all decisions; must outlive the strategy.
+     * @param rules The rules of the games.
+     * @param placement How the own fleet is placed.
+     * @throws std::invalid_argument if the rules are not valid.
+     */
+    explicit RandomStrategy(Random& random,
+            const RuleSet& rules = STANDARD_RULES,
+            FleetGenerator::Policy placement = FleetGenerator::AVOID_EDGES);
+
+    /**
+     * @brief Places the whole fleet on an empty grid.
+     *
+     * @param grid The empty grid.
+     * @return false if the fleet could not be placed.
+     */
+    bool placeFleet(OwnGrid& grid);
+
+    /**
+     * @brief Chooses a random open cell.
+     *
+     * @param grid The results of the own shots so far.
+     * @return The target, or an off-grid index if no cell is open.
+     */
+    CellIndex nextShot(const OpponentGrid& grid);
+
+    /**
+     * @brief Ignores the result of the last shot; the grid records it.
+     */
+    void observe(CellIndex, Shot::Impact) {
+    }
+
+    /**
+     * @brief Forgets the state of the fleet generator between games.
+     */
+    void reset();
+};
+
+#endif /* RANDOMSTRATEGY_H_ */
@@ -0,0 +1,148 @@
+/**
+ * @file ReplayBoard.cpp
+ * @brief Implementation file for the ReplayBoard class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "ReplayBoard.h"
+
+using namespace std;
+
+/**
+ * @brief Default constructor creating an empty 0 x 0 board.
+ */
+ReplayBoard::ReplayBoard() : rows{0}, columns{0}, shipCounts{0, 0} {
+}
+
+/**
+ * @brief Starts a new game without ships or shots.
+ *
+ * @param rows Rows of the grids.
+ * @param columns Columns of the grids.
+ */
+void ReplayBoard::start(int rows, int columns) {
+    this->rows = rows;
+    this->columns = columns;
+    for (int player = 0; player < 2; player++) {
+        shipCounts[player] = 0;
+        fleetCells[player] = Bitboard{};
+        shots[player] = Bitboard{};
+        sunk[player] = Bitboard{};
+        frontier[player] = Bitboard{};
+    }
+}
+
+/**
+ * @brief Adds a ship to a player's fleet.
+ *
+ * @param player 0 for the first player, 1 for the second.
+ * @param first The top or left cell of the ship.
+ * @param length The number of cells, at least 1.
+ * @param vertical True if the ship runs down a column.
+ * @return false, adding nothing, if the ship leaves the grid or the player
+ *         already has MAX_SHIPS ships.
+ */
+bool ReplayBoard::addShip(int player, int first, int length, bool vertical) {
+    int step = vertical ? columns : 1;
+    int last = first + (length - 1) * step;
+    if (shipCounts[player] == MAX_SHIPS || length < 1 || first < 0
+            || last >= getCells()
+            || (vertical == false && first / columns != last / columns)) {
+        return false;
+    }
+    Bitboard cells;
+    for (int cell = first; cell <= last; cell += step) {
+        cells |= Bitboard::cell(cell);
+    }
+    ships[player][shipCounts[player]++] = cells;
+    fleetCells[player] |= cells;
+    return true;
+}
+
+/**
+ * @brief Collects the orthogonal neighbours of cells.
+ *
+ * @param cells The cells; rarely more than a few.
+ * @return The neighbours on the grid.
+ */
+Bitboard ReplayBoard::neighbours(Bitboard cells) const {
+    Bitboard result;
+    for (int cell = cells.popFirst(); cell >= 0; cell = cells.popFirst()) {
+        int columnIndex = cell % columns;
+        if (columnIndex > 0) {
+            result |= Bitboard::cell(cell - 1);
+        }
+        if (columnIndex + 1 < columns) {
+            result |= Bitboard::cell(cell + 1);
+        }
+        if (cell >= columns) {
+            result |= Bitboard::cell(cell - columns);
+        }
+        if (cell + columns < getCells()) {
+            result |= Bitboard::cell(cell + columns);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Fires a shot at the opposing fleet.
+ *
+ * @param player 0 for the first player, 1 for the second.
+ * @param target The cell shot at; getCells() for an off-grid shot.
+ * @return The impact the defender reported.
+ */
+Shot::Impact ReplayBoard::fire(int player, int target) {
+    if (target < 0 || target >= getCells()) {
+        return Shot::Impact::NONE;
+    }
+    Bitboard cell = Bitboard::cell(target);
+    shots[player] |= cell;
+    frontier[player] &= ~cell;
+    if (fleetCells[1 - player].test(target) == false) {
+        return Shot::Impact::NONE;
+    }
+    for (int index = 0; index < shipCounts[1 - player]; index++) {
+        Bitboard ship = ships[1 - player][index];
+        if (ship.test(target) == false) {
+            continue;
+        }
+        if (ship.isSubsetOf(shots[player]) == false) {
+            frontier[player] |= neighbours(cell) & ~shots[player];
+            return Shot::Impact::HIT;
+        }
+        // Only the other open hits keep their neighbours
+        if (sunk[player].intersects(ship) == false) {
+            sunk[player] |= ship;
+            frontier[player] = neighbours(shots[player]
+                    & fleetCells[1 - player] & ~sunk[player])
+                    & ~shots[player];
+        }
+        return Shot::Impact::SUNKEN;
+    }
+    return Shot::Impact::NONE;
+}
+
+/**
+ * @brief Replaces the shots of a player, e.g. from a keyframe.
+ *
+ * @param player 0 for the first player, 1 for the second.
+ * @param cells The cells the player has shot at.
+ */
+void ReplayBoard::restore(int player, Bitboard cells) {
+    shots[player] = cells & Bitboard::firstCells(getCells());
+    sunk[player] = Bitboard{};
+    for (int index = 0; index < shipCounts[1 - player]; index++) {
+        Bitboard ship = ships[1 - player][index];
+        if (ship.isSubsetOf(shots[player])) {
+            sunk[player] |= ship;
+        }
+    }
+    frontier[player] = neighbours(shots[player] & fleetCells[1 - player]
+            & ~sunk[player]) & ~shots[player];
+}
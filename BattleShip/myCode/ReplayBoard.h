@@ -0,0 +1,168 @@
+/**
+ * @file ReplayBoard.h
+ * @brief Header file for the ReplayBoard class, which follows a recorded
+ *        game shot by shot for the replay encoder and decoder.
+ *
+ * @details The replay format stores the fleets but no impacts, and stores
+ *          each target relative to what the shooter knows at that point
+ *          (see GameRecord.h). Writer and reader both replay the game on a
+ *          ReplayBoard, so they agree on every target's context.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef REPLAYBOARD_H_
+#define REPLAYBOARD_H_
+
+#include "Bitboard.h"
+#include "Ship.h"
+#include "Shot.h"
+#include <array>
+
+/**
+ * @class ReplayBoard
+ * @brief Both fleets of a recorded game and the shots fired at them.
+ *
+ * @details Impacts follow the rules of OwnGrid::takeBlow(): a shot at a ship
+ *          whose cells have all been shot is SUNKEN, also when repeated.
+ *          The ships are held in fixed arrays, so a board allocates no
+ *          memory and the reader can create one for every seek.
+ */
+class ReplayBoard {
+public:
+    static constexpr int MAX_SHIPS = Bitboard::CAPACITY
+            / Ship::MIN_LENGTH; ///< Most ships a legal fleet can have.
+
+private:
+    int rows;    ///< Rows of the grids.
+    int columns; ///< Columns of the grids.
+    std::array<std::array<Bitboard, MAX_SHIPS>, 2> ships; ///< Cells of each
+                                                          ///< player's ships.
+    std::array<int, 2> shipCounts; ///< Ships of each player.
+    std::array<Bitboard, 2> fleetCells; ///< Cells of each player's fleet.
+    std::array<Bitboard, 2> shots; ///< Cells each player has shot at.
+    std::array<Bitboard, 2> sunk;  ///< Cells of the opposing ships each
+                                   ///< player has sunk.
+    std::array<Bitboard, 2> frontier; ///< See getFrontier().
+
+    /**
+     * @brief Collects the orthogonal neighbours of cells.
+     *
+     * @param cells The cells; rarely more than a few.
+     * @return The neighbours on the grid.
+     */
+    Bitboard neighbours(Bitboard cells) const;
+
+public:
+    /**
+     * @brief Computes the width of a bit field of the replay format.
+     *
+     * @param largest The largest value the field must hold.
+     * @return The number of bits, 0 if the field can only hold 0.
+     */
+    static int fieldBits(int largest) {
+        int bits = 0;
+        for (; largest > 0; largest >>= 1) {
+            bits++;
+        }
+        return bits;
+    }
+
+    /**
+     * @brief Default constructor creating an empty 0 x 0 board.
+     */
+    ReplayBoard();
+
+    /**
+     * @brief Starts a new game without ships or shots.
+     *
+     * @param rows Rows of the grids.
+     * @param columns Columns of the grids; rows * columns must not exceed
+     *        Bitboard::CAPACITY.
+     */
+    void start(int rows, int columns);
+
+    /**
+     * @brief Adds a ship to a player's fleet.
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @param first The top or left cell of the ship.
+     * @param length The number of cells, at least 1.
+     * @param vertical True if the ship runs down a column.
+     * @return false, adding nothing, if the ship leaves the grid or the
+     *         player already has MAX_SHIPS ships.
+     */
+    bool addShip(int player, int first, int length, bool vertical);
+
+    /**
+     * @brief Getter method to retrieve the number of cells of a grid.
+     *
+     * @return rows * columns; also the target of off-grid shots.
+     */
+    int getCells() const {
+        return rows * columns;
+    }
+
+    /**
+     * @brief Getter method to retrieve the cells of a player's fleet.
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @return The cells of all of the player's ships.
+     */
+    Bitboard getFleetCells(int player) const {
+        return fleetCells[player];
+    }
+
+    /**
+     * @brief Getter method to retrieve the cells a player has shot at.
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @return The shot cells on the opposing grid.
+     */
+    Bitboard getShots(int player) const {
+        return shots[player];
+    }
+
+    /**
+     * @brief Finds the cells a player is most likely to shoot next.
+     *
+     * @details These are the cells next to a hit on a ship that is still
+     *          afloat which the player has not shot yet. Targeting
+     *          strategies pick almost all their shots from them. The set is
+     *          kept up to date by fire().
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @return The unshot orthogonal neighbours of the player's open hits.
+     */
+    Bitboard getFrontier(int player) const {
+        return frontier[player];
+    }
+
+    /**
+     * @brief Fires a shot at the opposing fleet.
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @param target The cell shot at; getCells() for an off-grid shot.
+     * @return The impact the defender reported.
+     */
+    Shot::Impact fire(int player, int target);
+
+    /**
+     * @brief Replaces the shots of a player, e.g. from a keyframe.
+     *
+     * @details The sunk ships and the frontier are derived from the shots,
+     *          so the board continues as if the shots had been fired one by
+     *          one.
+     *
+     * @param player 0 for the first player, 1 for the second.
+     * @param cells The cells the player has shot at; cells off the grid are
+     *        ignored.
+     */
+    void restore(int player, Bitboard cells);
+};
+
+#endif /* REPLAYBOARD_H_ */
@@ -0,0 +1,391 @@
+/**
+ * @file ReplayReader.cpp
+ * @brief Implementation file for the ReplayReader class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "ReplayReader.h"
+#include "ReplayWriter.h"
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @struct ReplayReader::Header
+ * @brief The decoded fixed part of a game.
+ */
+struct ReplayReader::Header {
+    int moveCount = 0;        ///< Moves of the game.
+    int keyframeInterval = 0; ///< Moves between two keyframes, 0 for none.
+    int keyframeCount = 0;    ///< Keyframes of the game.
+    size_t keyframes = 0;     ///< Start of the keyframe table in bytes.
+    size_t moves = 0;         ///< Bit offset of the first move.
+    size_t end = 0;           ///< End of the game in bytes.
+};
+
+/**
+ * @brief Reads a varint.
+ *
+ * @param data The bytes.
+ * @param offset Position of the varint; moved behind it.
+ * @param value Receives the value.
+ * @return false if the data ends inside the varint or it is too long.
+ */
+static bool readVarint(string_view data, size_t& offset, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && offset < data.size(); shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(data[offset++]);
+        value |= uint64_t(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Reads a field of a bit stream.
+ *
+ * @param data The bytes of the stream.
+ * @param bits Bit offset of the field; moved behind it.
+ * @param width Bits of the field, 0 to 32.
+ * @param value Receives the value.
+ * @return false if the data ends inside the field.
+ */
+static bool readBits(string_view data, size_t& bits, int width,
+        uint32_t& value) {
+    if (data.size() * 8 - bits < size_t(width)) {
+        return false;
+    }
+    value = 0;
+    for (int read = 0; read < width;) {
+        int room = 8 - static_cast<int>(bits % 8);
+        int chunk = min(room, width - read);
+        uint32_t byte = static_cast<uint8_t>(data[bits / 8]);
+        value |= ((byte >> (bits % 8)) & ((1u << chunk) - 1)) << read;
+        read += chunk;
+        bits += chunk;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a keyframe and restarts the board from it.
+ *
+ * @param data The bytes of the stream.
+ * @param bits Bit offset of the keyframe; moved behind it.
+ * @param board Receives both players' shots.
+ * @return false if the data ends inside the keyframe.
+ */
+static bool readKeyframe(string_view data, size_t& bits,
+        ReplayBoard& board) {
+    int cells = board.getCells();
+    for (int player = 0; player < 2; player++) {
+        array<uint64_t, 2> words{};
+        for (int cell = 0; cell < cells; cell += 32) {
+            uint32_t value;
+            if (!readBits(data, bits, min(32, cells - cell), value)) {
+                return false;
+            }
+            words[cell / 64] |= uint64_t(value) << (cell % 64);
+        }
+        board.restore(player, Bitboard{words[0], words[1]});
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the target of a move.
+ *
+ * @param data The bytes of the stream.
+ * @param bits Bit offset of the move; moved behind it.
+ * @param board The game before the move.
+ * @param player The shooter.
+ * @param target Receives the cell; board.getCells() if off the grid.
+ * @return false if the move is damaged.
+ */
+static bool readTarget(string_view data, size_t& bits,
+        const ReplayBoard& board, int player, int& target) {
+    int cells = board.getCells();
+    Bitboard shots = board.getShots(player);
+    Bitboard frontier = board.getFrontier(player);
+    uint32_t value = 0;
+    if (frontier.any()) {
+        if (readBits(data, bits, 1, value) == false) {
+            return false;
+        }
+        if (value != 0) {
+            if (!readBits(data, bits,
+                        ReplayBoard::fieldBits(frontier.count() - 1), value)) {
+                return false;
+            }
+            target = frontier.nth(static_cast<int>(value));
+            return target >= 0;
+        }
+    }
+
+    Bitboard open = Bitboard::firstCells(cells) & ~shots & ~frontier;
+    uint32_t openCount = open.count();
+    if (!readBits(data, bits, ReplayBoard::fieldBits(openCount), value)
+            || value > openCount) {
+        return false;
+    }
+    if (value < openCount) {
+        target = open.nth(static_cast<int>(value));
+        return true;
+    }
+    uint32_t shotCount = shots.count();
+    if (!readBits(data, bits, ReplayBoard::fieldBits(shotCount), value)
+            || value > shotCount) {
+        return false;
+    }
+    target = value < shotCount ? shots.nth(static_cast<int>(value)) : cells;
+    return true;
+}
+
+/**
+ * @brief Default constructor creating an empty reader.
+ */
+ReplayReader::ReplayReader() {
+}
+
+/**
+ * @brief Maps a replay file and indexes its games.
+ *
+ * @param path Path of the replay file.
+ * @return false if the file can't be mapped, has no replay header or ends
+ *         inside a game.
+ */
+bool ReplayReader::load(const std::string& path) {
+    offsets.clear();
+    bytes = string_view{};
+    if (file.open(path) == false) {
+        return false;
+    }
+    return parse(file.view());
+}
+
+/**
+ * @brief Indexes the games of replay data in memory.
+ *
+ * @param data The contents of a replay file.
+ * @return false if the data has no replay header or ends inside a game.
+ */
+bool ReplayReader::parse(std::string_view data) {
+    offsets.clear();
+    bytes = string_view{};
+    if (data.substr(0, 4) != string_view{ReplayWriter::MAGIC, 4}) {
+        return false;
+    }
+    bytes = data.substr(4);
+    size_t offset = 0;
+    while (offset < bytes.size()) {
+        size_t start = offset;
+        uint64_t size;
+        if (readVarint(bytes, offset, size) == false
+                || size > bytes.size() - offset) {
+            return false;
+        }
+        offsets.push_back(start);
+        offset += size;
+    }
+    return true;
+}
+
+/**
+ * @brief Getter method to retrieve the number of games.
+ *
+ * @return The number of complete games.
+ */
+size_t ReplayReader::getGameCount() const {
+    return offsets.size();
+}
+
+/**
+ * @brief Decodes the fixed part of a game.
+ *
+ * @param game Number of the game.
+ * @param header Receives the fixed part.
+ * @param board Receives the fleets, ready for the first move.
+ * @param record Receives the dimensions and fleets, may be nullptr.
+ * @return false if the game is damaged.
+ */
+bool ReplayReader::readHeader(std::size_t game, Header& header,
+        ReplayBoard& board, GameRecord* record) const {
+    if (game >= offsets.size()) {
+        return false;
+    }
+    size_t offset = offsets[game];
+    uint64_t value;
+    readVarint(bytes, offset, value);
+    header.end = offset + value;
+    string_view data = bytes.substr(0, header.end);
+    if (data.size() - offset < 2) {
+        return false;
+    }
+    int rows = static_cast<uint8_t>(data[offset++]);
+    int columns = static_cast<uint8_t>(data[offset++]);
+    int cells = rows * columns;
+    uint64_t moveCount;
+    uint64_t interval;
+    array<uint64_t, 2> shipCounts;
+    if (cells > Bitboard::CAPACITY || !readVarint(data, offset, moveCount)
+            || !readVarint(data, offset, interval)
+            || !readVarint(data, offset, shipCounts[0])
+            || !readVarint(data, offset, shipCounts[1])
+            || moveCount > data.size() * 8
+            || shipCounts[0] + shipCounts[1] > data.size() * 8) {
+        return false;
+    }
+    header.moveCount = static_cast<int>(moveCount);
+    header.keyframeInterval = static_cast<int>(min(interval, moveCount));
+    header.keyframeCount = interval == 0 || moveCount == 0 ? 0
+            : static_cast<int>((moveCount - 1) / interval);
+    header.keyframes = offset;
+    for (int keyframe = 0; keyframe < header.keyframeCount; keyframe++) {
+        if (readVarint(data, offset, value) == false) {
+            return false;
+        }
+    }
+    board.start(rows, columns);
+    if (record != nullptr) {
+        record->rows = rows;
+        record->columns = columns;
+    }
+
+    // The fleets start the bit stream
+    size_t bits = offset * 8;
+    int lengthBits = ReplayBoard::fieldBits(Ship::MAX_LENGTH);
+    int cellBits = ReplayBoard::fieldBits(cells - 1);
+    for (int player = 0; player < 2; player++) {
+        if (record != nullptr) {
+            record->fleets[player].clear();
+        }
+        for (uint64_t ship = 0; ship < shipCounts[player]; ship++) {
+            uint32_t length;
+            uint32_t first;
+            uint32_t vertical = 0;
+            if (!readBits(data, bits, lengthBits, length)
+                    || !readBits(data, bits, cellBits, first)
+                    || (length > 1 && !readBits(data, bits, 1, vertical))
+                    || !board.addShip(player, static_cast<int>(first),
+                            static_cast<int>(length), vertical != 0)) {
+                return false;
+            }
+            if (record != nullptr) {
+                int step = vertical != 0 ? columns : 1;
+                int last = static_cast<int>(first + (length - 1) * step);
+                record->fleets[player].emplace_back(
+                        CellIndex(uint16_t(first)).toPosition(columns),
+                        CellIndex(uint16_t(last)).toPosition(columns));
+            }
+        }
+    }
+    header.moves = bits;
+    return true;
+}
+
+/**
+ * @brief Decodes a complete game.
+ *
+ * @details The impacts are those implied by the decoded fleets.
+ *
+ * @param game Number of the game, below getGameCount().
+ * @param record Receives the game.
+ * @return false if game is out of range or damaged.
+ */
+bool ReplayReader::readGame(std::size_t game, GameRecord& record) const {
+    Header header;
+    ReplayBoard board;
+    if (readHeader(game, header, board, &record) == false) {
+        return false;
+    }
+    string_view data = bytes.substr(0, header.end);
+    size_t bits = header.moves;
+    record.moves.clear();
+    record.moves.reserve(header.moveCount);
+    for (int move = 0; move < header.moveCount; move++) {
+        int player = move & 1;
+        int target;
+        if (move > 0 && header.keyframeInterval > 0
+                && move % header.keyframeInterval == 0
+                && readKeyframe(data, bits, board) == false) {
+            return false;
+        }
+        if (!readTarget(data, bits, board, player, target)) {
+            return false;
+        }
+        Shot::Impact impact = board.fire(player, target);
+        record.moves.push_back(GameRecord::Move{
+                CellIndex(uint16_t(target)), impact});
+    }
+    return true;
+}
+
+/**
+ * @brief Computes the shots of a game after a number of moves.
+ *
+ * @details Starts from the last keyframe at or before the move and decodes
+ *          the moves after it; the keyframe holds the shots every later
+ *          target is stored against. The hits follow from the shots and the
+ *          fleets.
+ *
+ * @param game Number of the game, below getGameCount().
+ * @param move Number of moves played, at most the moves of the game.
+ * @param state Receives the shots and hits.
+ * @return false if game or move are out of range or the game is damaged.
+ */
+bool ReplayReader::stateAt(std::size_t game, int move,
+        ReplayState& state) const {
+    Header header;
+    ReplayBoard board;
+    if (readHeader(game, header, board, nullptr) == false || move < 0
+            || move > header.moveCount) {
+        return false;
+    }
+    string_view data = bytes.substr(0, header.end);
+    size_t bits = header.moves;
+
+    // Jump to the keyframe
+    int start = 0;
+    if (header.keyframeInterval > 0) {
+        int keyframes = min(move / header.keyframeInterval,
+                header.keyframeCount);
+        size_t table = header.keyframes;
+        for (int keyframe = 0; keyframe < keyframes; keyframe++) {
+            uint64_t delta;
+            readVarint(data, table, delta);
+            if (delta > data.size() * 8 - bits) {
+                return false;
+            }
+            bits += delta;
+        }
+        start = keyframes * header.keyframeInterval;
+        if (keyframes > 0 && readKeyframe(data, bits, board) == false) {
+            return false;
+        }
+    }
+
+    // Decode the moves after it
+    for (int current = start; current < move; current++) {
+        int player = current & 1;
+        int target;
+        if (!readTarget(data, bits, board, player, target)) {
+            return false;
+        }
+        board.fire(player, target);
+    }
+    state.move = move;
+    for (int player = 0; player < 2; player++) {
+        state.shots[player] = board.getShots(player);
+        state.hits[player] = state.shots[player]
+                & board.getFleetCells(1 - player);
+    }
+    return true;
+}
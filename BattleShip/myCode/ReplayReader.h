@@ -0,0 +1,111 @@
+/**
+ * @file ReplayReader.h
+ * @brief Header file for the ReplayReader class, which gives random access
+ *        to the games of a binary replay file.
+ *
+ * @details The format is described in GameRecord.h.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef REPLAYREADER_H_
+#define REPLAYREADER_H_
+
+#include "GameRecord.h"
+#include "MappedFile.h"
+#include "ReplayBoard.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ReplayReader
+ * @brief Reads games and positions from a replay file.
+ *
+ * @details load() maps the file and finds the start of every game by
+ *          skipping over their lengths, without decoding them. stateAt()
+ *          decodes the fleets and the moves between the last keyframe and
+ *          the wanted move.
+ */
+class ReplayReader {
+private:
+    MappedFile file;         ///< The mapped replay file.
+    std::string_view bytes;  ///< The games, after the file header.
+    std::vector<std::size_t> offsets; ///< Start of each game in bytes.
+
+    /**
+     * @struct Header
+     * @brief The decoded fixed part of a game.
+     */
+    struct Header;
+
+    /**
+     * @brief Decodes the fixed part of a game.
+     * @param game Number of the game.
+     * @param header Receives the fixed part.
+     * @param board Receives the fleets, ready for the first move.
+     * @param record Receives the dimensions and fleets, may be nullptr.
+     * @return false if the game is damaged.
+     */
+    bool readHeader(std::size_t game, Header& header, ReplayBoard& board,
+            GameRecord* record) const;
+
+public:
+    /**
+     * @brief Default constructor creating an empty reader.
+     */
+    ReplayReader();
+
+    /**
+     * @brief Maps a replay file and indexes its games.
+     *
+     * @param path Path of the replay file.
+     * @return false if the file can't be mapped, has no replay header or
+     *         ends inside a game; the complete games before it are kept.
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Indexes the games of replay data in memory.
+     *
+     * @param data The contents of a replay file; must stay valid while the
+     *        reader is used.
+     * @return false if the data has no replay header or ends inside a game;
+     *         the complete games before it are kept.
+     */
+    bool parse(std::string_view data);
+
+    /**
+     * @brief Getter method to retrieve the number of games.
+     *
+     * @return The number of complete games.
+     */
+    std::size_t getGameCount() const;
+
+    /**
+     * @brief Decodes a complete game.
+     *
+     * @param game Number of the game, below getGameCount().
+     * @param record Receives the game.
+     * @return false if game is out of range or damaged.
+     */
+    bool readGame(std::size_t game, GameRecord& record) const;
+
+    /**
+     * @brief Computes the shots of a game after a number of moves.
+     *
+     * @param game Number of the game, below getGameCount().
+     * @param move Number of moves played, at most the moves of the game.
+     * @param state Receives the shots and hits.
+     * @return false if game or move are out of range or the game is
+     *         damaged.
+     */
+    bool stateAt(std::size_t game, int move, ReplayState& state) const;
+};
+
+#endif /* REPLAYREADER_H_ */
@@ -0,0 +1,260 @@
+/**
+ * @file ReplayWriter.cpp
+ * @brief Implementation file for the ReplayWriter class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "ReplayWriter.h"
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief Appends an unsigned integer as a varint.
+ *
+ * @param value The value.
+ * @param bytes Receives the 1 to 10 bytes.
+ */
+static void writeVarint(uint64_t value, string& bytes) {
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief Computes the number of bytes of a varint.
+ *
+ * @param value The value.
+ * @return The number of bytes writeVarint() appends.
+ */
+static size_t varintSize(uint64_t value) {
+    size_t size = 1;
+    for (; value >= 0x80; value >>= 7) {
+        size++;
+    }
+    return size;
+}
+
+/**
+ * @brief Appends a field to a bit stream.
+ *
+ * @param value The value; must fit into the field.
+ * @param width Bits of the field, 0 to 32.
+ * @param bytes The stream; receives new bytes as needed.
+ * @param bits Number of bits of the stream; moved behind the field.
+ */
+static void writeBits(uint32_t value, int width, string& bytes,
+        size_t& bits) {
+    for (int written = 0; written < width;) {
+        if (bits % 8 == 0) {
+            bytes.push_back(0);
+        }
+        int room = 8 - static_cast<int>(bits % 8);
+        int chunk = min(room, width - written);
+        uint32_t part = (value >> written) & ((1u << chunk) - 1);
+        bytes.back() = static_cast<char>(
+                static_cast<uint8_t>(bytes.back()) | part << (bits % 8));
+        written += chunk;
+        bits += chunk;
+    }
+}
+
+/**
+ * @brief Appends a keyframe to a bit stream and restarts the board from it.
+ *
+ * @details Both players' shots are stored as masks of board.getCells()
+ *          bits. Restoring the board from them gives the writer the same
+ *          target context as a reader that starts decoding here.
+ *
+ * @param board The game before the keyframe's move.
+ * @param bytes The stream.
+ * @param bits Number of bits of the stream; moved behind the keyframe.
+ */
+static void writeKeyframe(ReplayBoard& board, string& bytes, size_t& bits) {
+    int cells = board.getCells();
+    for (int player = 0; player < 2; player++) {
+        Bitboard shots = board.getShots(player);
+        for (int cell = 0; cell < cells; cell += 32) {
+            uint64_t word = cell < 64 ? shots.getLow() : shots.getHigh();
+            writeBits(static_cast<uint32_t>(word >> (cell % 64)),
+                    min(32, cells - cell), bytes, bits);
+        }
+        board.restore(player, shots);
+    }
+}
+
+/**
+ * @brief Appends the target of a move to a bit stream.
+ *
+ * @param board The game before the move.
+ * @param player The shooter.
+ * @param target The cell shot at; board.getCells() if off the grid.
+ * @param bytes The stream.
+ * @param bits Number of bits of the stream; moved behind the move.
+ */
+static void writeTarget(const ReplayBoard& board, int player, int target,
+        string& bytes, size_t& bits) {
+    int cells = board.getCells();
+    Bitboard shots = board.getShots(player);
+    Bitboard frontier = board.getFrontier(player);
+    if (frontier.any()) {
+        bool inFrontier = target < cells && frontier.test(target);
+        writeBits(inFrontier, 1, bytes, bits);
+        if (inFrontier) {
+            writeBits(frontier.rankOf(target),
+                    ReplayBoard::fieldBits(frontier.count() - 1), bytes, bits);
+            return;
+        }
+    }
+
+    // Fresh cells by rank, with one more value for the rare other shots
+    Bitboard open = Bitboard::firstCells(cells) & ~shots & ~frontier;
+    int openCount = open.count();
+    bool isNew = target < cells && open.test(target);
+    writeBits(isNew ? open.rankOf(target) : openCount,
+            ReplayBoard::fieldBits(openCount), bytes, bits);
+    if (isNew == false) {
+        writeBits(target < cells ? shots.rankOf(target) : shots.count(),
+                ReplayBoard::fieldBits(shots.count()), bytes, bits);
+    }
+}
+
+/**
+ * @brief Default constructor creating a closed writer.
+ */
+ReplayWriter::ReplayWriter() : keyframeInterval{DEFAULT_KEYFRAME_INTERVAL} {
+}
+
+/**
+ * @brief Opens a file for appending; writes the file header if the file is
+ *        new or empty.
+ *
+ * @param path Path of the replay file.
+ * @return true if the file could be opened.
+ */
+bool ReplayWriter::open(const std::string& path) {
+    close();
+    out.open(path, ios::binary | ios::app);
+    if (!out) {
+        return false;
+    }
+    out.seekp(0, ios::end);
+    if (out.tellp() == 0) {
+        out.write(MAGIC, 4);
+    }
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Closes the file.
+ */
+void ReplayWriter::close() {
+    if (out.is_open()) {
+        out.close();
+    }
+    out.clear();
+}
+
+/**
+ * @brief Sets the number of moves between two keyframes.
+ *
+ * @param interval Number of moves, 0 for no keyframes.
+ */
+void ReplayWriter::setKeyframeInterval(int interval) {
+    keyframeInterval = max(0, interval);
+}
+
+/**
+ * @brief Appends a game to the file.
+ *
+ * @param game The game.
+ * @return false if no file is open or the game could not be written.
+ */
+bool ReplayWriter::write(const GameRecord& game) {
+    if (out.is_open() == false) {
+        return false;
+    }
+    buffer.clear();
+    encode(game, buffer);
+    out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Appends the encoding of a game to a buffer.
+ *
+ * @details The bit stream is encoded first because its size comes before
+ *          it.
+ *
+ * @param game The game.
+ * @param bytes Receives the encoded game.
+ */
+void ReplayWriter::encode(const GameRecord& game, std::string& bytes) {
+    int cells = game.rows * game.columns;
+    int moveCount = static_cast<int>(game.moves.size());
+    int lengthBits = ReplayBoard::fieldBits(Ship::MAX_LENGTH);
+    int cellBits = ReplayBoard::fieldBits(cells - 1);
+
+    // Fleets, which the moves are encoded against
+    stream.clear();
+    size_t bits = 0;
+    board.start(game.rows, game.columns);
+    for (int player = 0; player < 2; player++) {
+        for (const Ship& ship : game.fleets[player]) {
+            CellIndex bow = CellIndex::fromPosition(ship.getBow(),
+                    game.columns);
+            CellIndex stern = CellIndex::fromPosition(ship.getStern(),
+                    game.columns);
+            int first = min(bow.value(), stern.value());
+            bool vertical = ship.getBow().getColumn()
+                    == ship.getStern().getColumn() && ship.length() > 1;
+            writeBits(ship.length(), lengthBits, stream, bits);
+            writeBits(first, cellBits, stream, bits);
+            if (ship.length() > 1) {
+                writeBits(vertical, 1, stream, bits);
+            }
+            board.addShip(player, first, ship.length(), vertical);
+        }
+    }
+
+    // Moves, with a keyframe before every keyframeInterval-th move
+    keyframes.clear();
+    size_t keyframeBits = bits;
+    for (int move = 0; move < moveCount; move++) {
+        int player = move & 1;
+        if (move > 0 && keyframeInterval > 0
+                && move % keyframeInterval == 0) {
+            writeVarint(bits - keyframeBits, keyframes);
+            keyframeBits = bits;
+            writeKeyframe(board, stream, bits);
+        }
+        int target = min<int>(game.moves[move].target.value(), cells);
+        writeTarget(board, player, target, stream, bits);
+        board.fire(player, target);
+    }
+
+    // Size, header and the stream
+    size_t size = 2 + varintSize(moveCount) + varintSize(keyframeInterval)
+            + keyframes.size() + stream.size();
+    for (const vector<Ship>& fleet : game.fleets) {
+        size += varintSize(fleet.size());
+    }
+    writeVarint(size, bytes);
+    bytes.push_back(static_cast<char>(game.rows));
+    bytes.push_back(static_cast<char>(game.columns));
+    writeVarint(moveCount, bytes);
+    writeVarint(keyframeInterval, bytes);
+    for (const vector<Ship>& fleet : game.fleets) {
+        writeVarint(fleet.size(), bytes);
+    }
+    bytes += keyframes;
+    bytes += stream;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file ReplayWriter.h
+ * @brief Header file for the ReplayWriter class, which appends recorded
+ *        games to a binary replay file.
+ *
+ * @details The format is described in GameRecord.h.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef REPLAYWRITER_H_
+#define REPLAYWRITER_H_
+
+#include "GameRecord.h"
+#include "ReplayBoard.h"
+#include <fstream>
+#include <string>
+
+/**
+ * @class ReplayWriter
+ * @brief Appends games to a replay file.
+ *
+ * @details Every game is encoded into reused buffers and written with one
+ *          call, so a game is either written completely or not at all as
+ *          far as this process is concerned. A writer is not thread safe.
+ */
+class ReplayWriter {
+public:
+    static constexpr int DEFAULT_KEYFRAME_INTERVAL = 32; ///< Moves between
+                                                         ///< two keyframes.
+    static constexpr char MAGIC[5] = "BSR3"; ///< First bytes of a file.
+
+private:
+    std::ofstream out;     ///< The open file.
+    std::string buffer;    ///< Encoding of the current game.
+    std::string stream;    ///< Bit stream of the current game.
+    std::string keyframes; ///< Keyframe table of the current game.
+    ReplayBoard board;     ///< The current game, followed move by move.
+    int keyframeInterval;  ///< Moves between two keyframes, 0 for none.
+
+public:
+    /**
+     * @brief Default constructor creating a closed writer.
+     */
+    ReplayWriter();
+
+    /**
+     * @brief Opens a file for appending; writes the file header if the file
+     *        is new or empty.
+     *
+     * @param path Path of the replay file.
+     * @return true if the file could be opened.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Closes the file.
+     */
+    void close();
+
+    /**
+     * @brief Sets the number of moves between two keyframes.
+     *
+     * @details Smaller intervals make seeking faster and files larger; every
+     *          keyframe takes about 26 bytes on a 10 x 10 grid.
+     *
+     * @param interval Number of moves, 0 for no keyframes.
+     */
+    void setKeyframeInterval(int interval);
+
+    /**
+     * @brief Appends a game to the file.
+     *
+     * @param game The game; targets off the grid are stored as off-grid,
+     *        impacts are not stored.
+     * @return false if no file is open or the game could not be written.
+     */
+    bool write(const GameRecord& game);
+
+    /**
+     * @brief Appends the encoding of a game to a buffer, e.g. to write
+     *        many games at once.
+     *
+     * @param game The game; impacts are not stored.
+     * @param bytes Receives the encoded game.
+     */
+    void encode(const GameRecord& game, std::string& bytes);
+};
+
+#endif /* REPLAYWRITER_H_ */
@@ -0,0 +1,172 @@
+/**
+ * @file RuleSet.cpp
+ * @brief Implementation file for loading RuleSet objects from configuration
+ *        text.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "RuleSet.h"
+#include "MappedFile.h"
+
+using namespace std;
+
+/**
+ * @brief Removes leading and trailing blanks from a piece of text.
+ *
+ * @param text The text to trim.
+ * @return The text without surrounding spaces, tabs or carriage returns.
+ */
+static string_view trim(string_view text) {
+    size_t first = text.find_first_not_of(" \t\r");
+    if (first == string_view::npos) {
+        return string_view();
+    }
+    size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+/**
+ * @brief Parses a small non-negative decimal number.
+ *
+ * @param text The digits to parse.
+ * @param number Receives the value on success.
+ * @return True if the text consists of one to four digits.
+ */
+static bool parseNumber(string_view text, int& number) {
+    if (text.empty() || text.size() > 4) {
+        return false;
+    }
+    int value = 0;
+    for (char digit : text) {
+        if (digit < '0' || digit > '9') {
+            return false;
+        }
+        value = value * 10 + (digit - '0');
+    }
+    number = value;
+    return true;
+}
+
+/**
+ * @brief Parses a rule set from configuration text.
+ *
+ * @param text The configuration text.
+ * @param rules Receives the parsed rule set on success.
+ * @return OK on success, otherwise the reason the text was rejected.
+ */
+RuleSet::ParseResult RuleSet::parse(std::string_view text, RuleSet& rules) {
+    RuleSet parsed = STANDARD_RULES;
+
+    while (!text.empty()) {
+        size_t lineEnd = text.find('\n');
+        string_view line = text.substr(0, lineEnd);
+        text = (lineEnd == string_view::npos) ? string_view()
+                : text.substr(lineEnd + 1);
+
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) {
+            continue;
+        }
+        size_t separator = line.find('=');
+        if (separator == string_view::npos) {
+            return BAD_SYNTAX;
+        }
+        string_view key = trim(line.substr(0, separator));
+        string_view value = trim(line.substr(separator + 1));
+
+        if (key == "rows") {
+            if (!parseNumber(value, parsed.rows)) {
+                return BAD_SYNTAX;
+            }
+        } else if (key == "columns") {
+            if (!parseNumber(value, parsed.columns)) {
+                return BAD_SYNTAX;
+            }
+        } else if (key == "ships") {
+            parsed.shipQuota.fill(0);
+            while (!value.empty()) {
+                size_t comma = value.find(',');
+                int length = 0;
+                if (!parseNumber(trim(value.substr(0, comma)), length)
+                        || length > Ship::MAX_LENGTH) {
+                    return BAD_SYNTAX;
+                }
+                parsed.shipQuota[length]++;
+                value = (comma == string_view::npos) ? string_view()
+                        : value.substr(comma + 1);
+            }
+        } else if (key == "touching") {
+            if (value == "true") {
+                parsed.shipsMayTouch = true;
+            } else if (value == "false") {
+                parsed.shipsMayTouch = false;
+            } else {
+                return BAD_SYNTAX;
+            }
+        } else {
+            return BAD_SYNTAX;
+        }
+    }
+
+    // Grids keep their cells in Bitboard masks and rows in letters
+    if (parsed.isTooLarge()) {
+        return TOO_LARGE;
+    }
+    if (!parsed.isValid()) {
+        return INVALID;
+    }
+    rules = parsed;
+    return OK;
+}
+
+/**
+ * @brief Loads a rule set from a configuration file.
+ *
+ * @param path Path of the configuration file.
+ * @param rules Receives the loaded rule set on success.
+ * @return OK on success, UNREADABLE if the file can't be opened,
+ *         otherwise the result of parse().
+ */
+RuleSet::ParseResult RuleSet::load(const std::string& path, RuleSet& rules) {
+    MappedFile file;
+    if (!file.open(path)) {
+        return UNREADABLE;
+    }
+    return parse(file.view(), rules);
+}
+
+/**
+ * @brief Overloads the << operator to print the console message that
+ *        describes the outcome of parsing rules.
+ *
+ * @param lhs Output stream to which the message is written.
+ * @param rhs The outcome to describe.
+ * @return Reference to the output stream.
+ */
+ostream& operator<<(ostream& lhs, RuleSet::ParseResult rhs) {
+    switch (rhs) {
+    case RuleSet::OK:
+        lhs << "Rules loaded";
+        break;
+    case RuleSet::UNREADABLE:
+        lhs << "Rules file can't be opened";
+        break;
+    case RuleSet::BAD_SYNTAX:
+        lhs << "Rules are not \"key = value\" lines with known keys";
+        break;
+    case RuleSet::TOO_LARGE:
+        lhs << "Board is too large: at most " << RuleSet::MAX_ROWS
+                << " rows and " << Bitboard::CAPACITY << " cells";
+        break;
+    case RuleSet::INVALID:
+        lhs << "Board has no rows or columns, or the fleet has ships "
+                "shorter than " << Ship::MIN_LENGTH;
+        break;
+    }
+    return lhs;
+}
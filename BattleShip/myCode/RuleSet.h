@@ -0,0 +1,272 @@
+/**
+ * @file RuleSet.h
+ * @brief Header file for the RuleSet class, which describes the board size,
+ *        the fleet and the touching rule of a game variant.
+ *
+ * @details Grids, ships and the placement tables read their dimensions and
+ *          rules from a RuleSet instead of hard-coding the standard game.
+ *          Rule sets are constexpr values, so the standard rules
+ *          (STANDARD_RULES) and tables derived from them are built at
+ *          compile time; house rules can also be parsed at runtime from a
+ *          small configuration text.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef RULESET_H_
+#define RULESET_H_
+
+#include "Bitboard.h"
+#include "Ship.h"
+#include <array>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * @class RuleSet
+ * @brief Board dimensions, number of ships per length and touching rule.
+ *
+ * @details The number of ships of each length is stored in a small array
+ *          indexed by the length, so quota checks are a single lookup.
+ *
+ *          Boards are limited to 26 rows (the row letters 'A' to 'Z') and
+ *          Bitboard::CAPACITY (128) cells, because every grid keeps its
+ *          cells in 128 bit masks. A 10x12 or 11x11 board fits; a 12x12
+ *          board does not.
+ */
+class RuleSet {
+public:
+    /// Number of ships allowed for each length, indexed by the length.
+    using Quota = std::array<int, Ship::MAX_LENGTH + 1>;
+
+    /// The largest number of rows, one for each row letter.
+    static constexpr int MAX_ROWS = 26;
+
+    /**
+     * @enum ParseResult
+     * @brief Enum to represent the outcome of parsing or loading rules.
+     */
+    enum ParseResult {
+        OK,           /**< Rules parsed successfully */
+        UNREADABLE,   /**< The file could not be opened */
+        BAD_SYNTAX,   /**< A line is not a known "key = value" pair */
+        TOO_LARGE,    /**< More than MAX_ROWS rows or more than
+                           Bitboard::CAPACITY cells */
+        INVALID       /**< No rows or columns, or ships shorter than
+                           Ship::MIN_LENGTH */
+    };
+
+private:
+    int rows;           ///< The number of rows of the board.
+    int columns;        ///< The number of columns of the board.
+    Quota shipQuota;    ///< Number of ships of each length.
+    bool shipsMayTouch; ///< True if ships may be placed next to each other.
+
+public:
+    /**
+     * @brief Constructor to initialize a rule set.
+     * @param rows The number of rows of the board (1 to MAX_ROWS).
+     * @param columns The number of columns of the board.
+     * @param shipQuota Number of ships of each length, indexed by length.
+     * @param shipsMayTouch True if ships may be placed next to each other.
+     */
+    constexpr RuleSet(int rows, int columns, const Quota& shipQuota,
+            bool shipsMayTouch)
+        : rows{rows}, columns{columns}, shipQuota{shipQuota},
+          shipsMayTouch{shipsMayTouch} {}
+
+    /**
+     * @brief The standard rules: 10x10 board, one ship of length 5, two of
+     *        length 4, three of length 3 and four of length 2, no touching.
+     * @return The standard rule set.
+     */
+    static constexpr RuleSet standard() {
+        return RuleSet{10, 10, Quota{0, 0, 4, 3, 2, 1}, false};
+    }
+
+    /**
+     * @brief The Hasbro rules: 10x10 board, ships of length 5, 4, 3, 3 and
+     *        2, no touching.
+     * @return The Hasbro rule set.
+     */
+    static constexpr RuleSet hasbro() {
+        return RuleSet{10, 10, Quota{0, 0, 1, 2, 1, 1}, false};
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of rows of the board.
+     * @return The number of rows.
+     */
+    constexpr int getRows() const {
+        return rows;
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of columns of the board.
+     * @return The number of columns.
+     */
+    constexpr int getColumns() const {
+        return columns;
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of cells of the board.
+     * @return rows * columns.
+     */
+    constexpr int getCells() const {
+        return rows * columns;
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of ships of a length.
+     * @param length The ship length.
+     * @return The number of ships of that length, 0 for lengths that are
+     *         not part of the fleet.
+     */
+    constexpr int getQuota(int length) const {
+        return (length >= 0 && length <= Ship::MAX_LENGTH)
+                ? shipQuota[length] : 0;
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of ships per length.
+     * @return The quota array, indexed by the ship length.
+     */
+    constexpr const Quota& getQuotas() const {
+        return shipQuota;
+    }
+
+    /**
+     * @brief Checks whether ships may be placed next to each other.
+     * @return True if touching ships are allowed.
+     */
+    constexpr bool mayShipsTouch() const {
+        return shipsMayTouch;
+    }
+
+    /**
+     * @brief Counts the ships of the fleet.
+     * @return The number of ships of all lengths.
+     */
+    constexpr int getFleetSize() const {
+        int ships = 0;
+        for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+                length++) {
+            ships += shipQuota[length];
+        }
+        return ships;
+    }
+
+    /**
+     * @brief Counts the cells covered by the whole fleet.
+     * @return The sum of the lengths of all ships.
+     */
+    constexpr int getFleetCells() const {
+        int cells = 0;
+        for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+                length++) {
+            cells += length * shipQuota[length];
+        }
+        return cells;
+    }
+
+    /**
+     * @brief Returns the mask of all cells of the board.
+     * @return The cells 0 to getCells() - 1.
+     */
+    constexpr Bitboard boardMask() const {
+        return Bitboard::firstCells(getCells());
+    }
+
+    /**
+     * @brief Checks whether the board exceeds the size grids can hold.
+     * @return True if the board has more than MAX_ROWS rows or more than
+     *         Bitboard::CAPACITY cells.
+     */
+    constexpr bool isTooLarge() const {
+        return rows > MAX_ROWS || rows * columns > Bitboard::CAPACITY;
+    }
+
+    /**
+     * @brief Checks whether the rule set can be played.
+     * @details Requires 1 to MAX_ROWS rows, at least one column, at most
+     *          Bitboard::CAPACITY cells, no ships shorter than
+     *          Ship::MIN_LENGTH and non-negative quotas.
+     * @return True if the rule set is valid.
+     */
+    constexpr bool isValid() const {
+        if (rows < 1 || columns < 1 || isTooLarge()) {
+            return false;
+        }
+        for (int length = 0; length <= Ship::MAX_LENGTH; length++) {
+            if (shipQuota[length] < 0
+                    || (length < Ship::MIN_LENGTH && shipQuota[length] != 0)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compares two rule sets.
+     * @param other The rule set to compare with.
+     * @return True if both describe the same game.
+     */
+    constexpr bool operator==(const RuleSet& other) const {
+        if (rows != other.rows || columns != other.columns
+                || shipsMayTouch != other.shipsMayTouch) {
+            return false;
+        }
+        for (int length = 0; length <= Ship::MAX_LENGTH; length++) {
+            if (shipQuota[length] != other.shipQuota[length]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Parses a rule set from configuration text.
+     * @details The text consists of "key = value" lines; '#' starts a
+     *          comment. Keys are "rows", "columns", "ships" (a comma
+     *          separated list of ship lengths, e.g. "5,4,3,3,2") and
+     *          "touching" ("true" or "false"). Missing keys keep the values
+     *          of the standard rules. On failure the output is unchanged.
+     * @param text The configuration text.
+     * @param rules Receives the parsed rule set on success.
+     * @return OK on success, otherwise the reason the text was rejected;
+     *         TOO_LARGE for boards beyond the limits of isTooLarge().
+     */
+    static ParseResult parse(std::string_view text, RuleSet& rules);
+
+    /**
+     * @brief Loads a rule set from a configuration file.
+     * @param path Path of the file (see parse() for the format).
+     * @param rules Receives the loaded rule set on success.
+     * @return OK on success, UNREADABLE if the file can't be opened,
+     *         otherwise the result of parse().
+     */
+    static ParseResult load(const std::string& path, RuleSet& rules);
+};
+
+/**
+ * @brief Overloads the << operator to print the console message that
+ *        describes the outcome of parsing rules.
+ *
+ * @param lhs Output stream to which the message is written.
+ * @param rhs The outcome to describe.
+ * @return Reference to the output stream.
+ */
+std::ostream& operator<<(std::ostream& lhs, RuleSet::ParseResult rhs);
+
+/**
+ * @brief The standard rules, see RuleSet::standard().
+ */
+inline constexpr RuleSet STANDARD_RULES = RuleSet::standard();
+
+#endif /* RULESET_H_ */
@@ -0,0 +1,291 @@
+/**
+ * @file SharedBoard.cpp
+ * @brief Implementation file for the SharedBoard class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "SharedBoard.h"
+
+using namespace std;
+
+/**
+ * @brief Converts the target of a shot to a cell index.
+ *
+ * @param shot The shot.
+ * @param rules The rules of the grid that is shot at.
+ * @param cell Receives the cell if the target is on the grid.
+ * @return false if the target is outside the grid.
+ */
+static bool targetCell(const Shot& shot, const RuleSet& rules,
+        CellIndex& cell) {
+    GridPosition target = shot.getTargetPosition();
+    if (target.isInside(rules.getRows(), rules.getColumns()) == false) {
+        return false;
+    }
+    cell = CellIndex::fromPosition(target, rules.getColumns());
+    return true;
+}
+
+/**
+ * @brief Constructor to create an empty position for a rule set.
+ *
+ * @param rules The board dimensions, fleet and touching rule.
+ */
+SharedBoard::SharedBoard(const RuleSet& rules)
+    : ownFleet{make_shared<const OwnGrid>(rules)},
+      opponentFleet{make_shared<const OpponentGrid>(rules)} {
+}
+
+/**
+ * @brief Constructor to create a snapshot of a board.
+ *
+ * @param board The board to take a snapshot of.
+ */
+SharedBoard::SharedBoard(const Board& board)
+    : shotMask{board.getOwnGrid().shotMask},
+      lowPlane{board.getOpponentGrid().lowPlane},
+      highPlane{board.getOpponentGrid().highPlane},
+      haloCells{board.getOpponentGrid().haloCells} {
+    auto ownGrid = make_shared<OwnGrid>(board.getOwnGrid());
+    ownGrid->clearJournal();
+    ownFleet = move(ownGrid);
+    auto opponentGrid = make_shared<OpponentGrid>(board.getOpponentGrid());
+    opponentGrid->clearJournal();
+    opponentFleet = move(opponentGrid);
+}
+
+/**
+ * @brief Creates another handle to the same position in O(1).
+ *
+ * @return A snapshot sharing both fleet parts with this one.
+ */
+SharedBoard SharedBoard::fork() const {
+    return *this;
+}
+
+/**
+ * @brief Getter method to retrieve the player's ships.
+ *
+ * @return The ships in the order they were placed.
+ */
+const vector<Ship>& SharedBoard::getShips() const {
+    return ownFleet->getShips();
+}
+
+/**
+ * @brief Getter method to retrieve the cells the opponent has shot at.
+ *
+ * @return The shot cells of the player's grid.
+ */
+Bitboard SharedBoard::getShotMask() const {
+    return shotMask;
+}
+
+/**
+ * @brief Getter method to retrieve the opponent's sunken ships.
+ *
+ * @return The ships inferred from the SUNKEN reports.
+ */
+const vector<Ship>& SharedBoard::getSunkenShip() const {
+    return opponentFleet->getSunkenShip();
+}
+
+/**
+ * @brief Getter method to retrieve the cells of the opponent's grid in a
+ *        state.
+ *
+ * @param state The state to look for.
+ * @return The cells in that state.
+ */
+Bitboard SharedBoard::getStateMask(OpponentGrid::CellState state) const {
+    switch (state) {
+    case OpponentGrid::MISS:
+        return lowPlane & ~highPlane;
+    case OpponentGrid::HIT:
+        return highPlane & ~lowPlane;
+    case OpponentGrid::SUNK:
+        return lowPlane & highPlane;
+    default:
+        return Bitboard::firstCells(opponentFleet->getRules().getCells())
+                & ~(lowPlane | highPlane);
+    }
+}
+
+/**
+ * @brief Builds a copy of the player's grid.
+ *
+ * @details Replaces the shot state of the shared grid with the shot mask
+ *          of this snapshot.
+ *
+ * @return The grid with an empty undo journal.
+ */
+OwnGrid SharedBoard::getOwnGrid() const {
+    OwnGrid grid = *ownFleet;
+    grid.shotMask = shotMask;
+    for (size_t ship = 0; ship < grid.ships.size(); ship++) {
+        grid.shipHits[ship] = (grid.ships[ship].occupiedMask(grid.rules)
+                & shotMask).count();
+    }
+    grid.rehash();
+    return grid;
+}
+
+/**
+ * @brief Builds a copy of the opponent's grid.
+ *
+ * @details Replaces the bit planes and the halo of the shared grid with
+ *          those of this snapshot; the sunken ships are the same.
+ *
+ * @return The grid with an empty undo journal.
+ */
+OpponentGrid SharedBoard::getOpponentGrid() const {
+    OpponentGrid grid = *opponentFleet;
+    grid.lowPlane = lowPlane;
+    grid.highPlane = highPlane;
+    grid.haloCells = haloCells;
+    grid.rehash();
+    return grid;
+}
+
+/**
+ * @brief Returns the position after placing a ship on the player's grid.
+ *
+ * @details Validates first so that a rejected ship costs no copy. The
+ *          placed ship starts a new shared grid.
+ *
+ * @param ship The ship to place.
+ * @param result Receives the outcome of the placement.
+ * @return The new position.
+ */
+SharedBoard SharedBoard::withPlacedShip(const Ship& ship,
+        PlacementResult& result) const {
+    result = ownFleet->validatePlacement(ship);
+    if (result.isValid() == false) {
+        return *this;
+    }
+    auto changedGrid = make_shared<OwnGrid>(getOwnGrid());
+    result = changedGrid->tryPlaceShip(ship);
+    changedGrid->clearJournal();
+
+    SharedBoard next = *this;
+    next.ownFleet = move(changedGrid);
+    return next;
+}
+
+/**
+ * @brief Returns the position after the opponent shot at the player.
+ *
+ * @details A ship is SUNKEN once all of its cells are in the shot mask,
+ *          as in OwnGrid::takeBlow(); only the mask is copied.
+ *
+ * @param shot The opponent's shot.
+ * @param impact Receives the impact of the shot.
+ * @return The new position.
+ */
+SharedBoard SharedBoard::withBlow(const Shot& shot, Shot::Impact& impact)
+        const {
+    impact = Shot::Impact::NONE;
+    CellIndex target;
+    // Shots outside the grid can't hit anything
+    if (targetCell(shot, ownFleet->getRules(), target) == false) {
+        return *this;
+    }
+
+    SharedBoard next = *this;
+    next.shotMask |= Bitboard::cell(target);
+    int shipId = ownFleet->shipIdAt(target);
+    if (shipId != OwnGrid::NO_SHIP) {
+        Bitboard shipCells = ownFleet->getShips()[shipId].occupiedMask(
+                ownFleet->getRules());
+        impact = shipCells.isSubsetOf(next.shotMask)
+                ? Shot::Impact::SUNKEN : Shot::Impact::HIT;
+    }
+    return next;
+}
+
+/**
+ * @brief Returns the position after recording the result of the player's
+ *        shot.
+ *
+ * @details A miss or a hit of a cell not reported otherwise before only
+ *          changes the bit planes and the halo, as in
+ *          OpponentGrid::shotResult(). A SUNKEN result or a correction
+ *          resolves ships, so it is recorded on a copy of the opponent's
+ *          grid, which becomes the new shared grid.
+ *
+ * @param shot The player's shot.
+ * @param impact The impact reported by the opponent.
+ * @return The new position.
+ */
+SharedBoard SharedBoard::withShotResult(const Shot& shot, Shot::Impact impact)
+        const {
+    const RuleSet& rules = opponentFleet->getRules();
+    CellIndex target;
+    // Shots outside the grid tell nothing about the ships
+    if (targetCell(shot, rules, target) == false) {
+        return *this;
+    }
+    OpponentGrid::CellState state = impact == Shot::Impact::NONE
+            ? OpponentGrid::MISS : impact == Shot::Impact::HIT
+            ? OpponentGrid::HIT : OpponentGrid::SUNK;
+    OpponentGrid::CellState previous = static_cast<OpponentGrid::CellState>(
+            int(lowPlane.test(target)) | int(highPlane.test(target)) << 1);
+
+    SharedBoard next = *this;
+    if (state == OpponentGrid::SUNK
+            || (previous != OpponentGrid::UNKNOWN && previous != state)) {
+        auto changedGrid = make_shared<OpponentGrid>(getOpponentGrid());
+        changedGrid->shotResultUnjournaled(target, impact);
+        next.lowPlane = changedGrid->lowPlane;
+        next.highPlane = changedGrid->highPlane;
+        next.haloCells = changedGrid->haloCells;
+        next.opponentFleet = move(changedGrid);
+        return next;
+    }
+    if (state == OpponentGrid::MISS) {
+        next.lowPlane |= Bitboard::cell(target);
+    } else {
+        next.highPlane |= Bitboard::cell(target);
+        if (rules.mayShipsTouch() == false) {
+            next.haloCells |= opponentFleet->diagonalNeighbours(target);
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief Checks whether two snapshots share both fleet parts.
+ *
+ * @param other The snapshot to compare with.
+ * @return true if both fleet parts are the same objects.
+ */
+bool SharedBoard::sharesFleetsWith(const SharedBoard& other) const {
+    return ownFleet == other.ownFleet && opponentFleet == other.opponentFleet;
+}
+
+/**
+ * @brief Checks whether two snapshots hold the same position in the same
+ *        shared objects.
+ *
+ * @param other The snapshot to compare with.
+ * @return true if both fleet parts are shared and all masks are equal.
+ */
+bool SharedBoard::sharesStateWith(const SharedBoard& other) const {
+    return sharesFleetsWith(other) && shotMask == other.shotMask
+            && lowPlane == other.lowPlane && highPlane == other.highPlane
+            && haloCells == other.haloCells;
+}
+
+/**
+ * @brief Copies the position into a mutable Board.
+ *
+ * @return A board with copies of both grids.
+ */
+Board SharedBoard::toBoard() const {
+    return Board{getOwnGrid(), getOpponentGrid()};
+}
@@ -0,0 +1,175 @@
+/**
+ * @file SharedBoard.h
+ * @brief Header file for the SharedBoard class, an immutable snapshot of a
+ *        Board whose grids are shared between copies.
+ *
+ * @details Rollouts and spectators branch a game position many times. A
+ *          SharedBoard splits each grid into a fleet part, which only
+ *          placements and sunken ships change and which copies share
+ *          through reference counted pointers to constant grids, and the
+ *          few bit masks of the shot cells that every move changes and each
+ *          snapshot holds by value. Forking copies these masks and two
+ *          pointers; a miss or a hit copies no grid at all. Because shared
+ *          grids are never modified, any number of threads may fork and
+ *          read the same snapshot at the same time.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef SHAREDBOARD_H_
+#define SHAREDBOARD_H_
+
+#include "Board.h"
+#include <memory>
+
+/**
+ * @class SharedBoard
+ * @brief Immutable, structurally shared game position.
+ *
+ * @details The "with" methods never modify the snapshot they are called on;
+ *          they return the position after the move. A shared grid is the
+ *          complete grid as of the move that last changed its fleet part;
+ *          the masks of the snapshot replace its shot state.
+ */
+class SharedBoard {
+private:
+    /// The player's grid as of the last placement.
+    std::shared_ptr<const OwnGrid> ownFleet;
+    /// The opponent's grid as of the last sunken ship or correction.
+    std::shared_ptr<const OpponentGrid> opponentFleet;
+    Bitboard shotMask;  ///< Shot cells of the player's grid.
+    Bitboard lowPlane;  ///< Low bit plane of the opponent's grid.
+    Bitboard highPlane; ///< High bit plane of the opponent's grid.
+    Bitboard haloCells; ///< Water inferred around the opponent's hits.
+
+public:
+    /**
+     * @brief Constructor to create an empty position for a rule set.
+     *
+     * @param rules The board dimensions, fleet and touching rule.
+     */
+    explicit SharedBoard(const RuleSet& rules = STANDARD_RULES);
+
+    /**
+     * @brief Constructor to create a snapshot of a board.
+     *
+     * @details Copies both grids once; later forks share these copies.
+     *
+     * @param board The board to take a snapshot of.
+     */
+    explicit SharedBoard(const Board& board);
+
+    /**
+     * @brief Creates another handle to the same position in O(1).
+     *
+     * @return A snapshot sharing both fleet parts with this one.
+     */
+    SharedBoard fork() const;
+
+    /**
+     * @brief Getter method to retrieve the player's ships.
+     *
+     * @return The ships in the order they were placed.
+     */
+    const std::vector<Ship>& getShips() const;
+
+    /**
+     * @brief Getter method to retrieve the cells the opponent has shot at.
+     *
+     * @return The shot cells of the player's grid.
+     */
+    Bitboard getShotMask() const;
+
+    /**
+     * @brief Getter method to retrieve the opponent's sunken ships.
+     *
+     * @return The ships inferred from the SUNKEN reports.
+     */
+    const std::vector<Ship>& getSunkenShip() const;
+
+    /**
+     * @brief Getter method to retrieve the cells of the opponent's grid in
+     *        a state.
+     *
+     * @param state The state to look for.
+     * @return The cells in that state.
+     */
+    Bitboard getStateMask(OpponentGrid::CellState state) const;
+
+    /**
+     * @brief Builds a copy of the player's grid.
+     *
+     * @return The grid with an empty undo journal.
+     */
+    OwnGrid getOwnGrid() const;
+
+    /**
+     * @brief Builds a copy of the opponent's grid.
+     *
+     * @return The grid with an empty undo journal.
+     */
+    OpponentGrid getOpponentGrid() const;
+
+    /**
+     * @brief Returns the position after placing a ship on the player's grid.
+     *
+     * @param ship The ship to place.
+     * @param result Receives the outcome of the placement.
+     * @return The new position; the same as this one if the ship could not
+     *         be placed.
+     */
+    SharedBoard withPlacedShip(const Ship& ship, PlacementResult& result)
+        const;
+
+    /**
+     * @brief Returns the position after the opponent shot at the player.
+     *
+     * @param shot The opponent's shot.
+     * @param impact Receives the impact of the shot.
+     * @return The new position; shares both fleet parts with this one.
+     */
+    SharedBoard withBlow(const Shot& shot, Shot::Impact& impact) const;
+
+    /**
+     * @brief Returns the position after recording the result of the
+     *        player's shot.
+     *
+     * @details Only a SUNKEN result or one that contradicts an earlier
+     *          result copies the opponent's grid.
+     *
+     * @param shot The player's shot.
+     * @param impact The impact reported by the opponent.
+     * @return The new position.
+     */
+    SharedBoard withShotResult(const Shot& shot, Shot::Impact impact) const;
+
+    /**
+     * @brief Checks whether two snapshots share both fleet parts.
+     *
+     * @param other The snapshot to compare with.
+     * @return true if both fleet parts are the same objects.
+     */
+    bool sharesFleetsWith(const SharedBoard& other) const;
+
+    /**
+     * @brief Checks whether two snapshots hold the same position in the
+     *        same shared objects.
+     *
+     * @param other The snapshot to compare with.
+     * @return true if both fleet parts are shared and all masks are equal.
+     */
+    bool sharesStateWith(const SharedBoard& other) const;
+
+    /**
+     * @brief Copies the position into a mutable Board.
+     *
+     * @return A board with copies of both grids.
+     */
+    Board toBoard() const;
+};
+
+#endif /* SHAREDBOARD_H_ */
@@ -12,36 +12,30 @@
  */
 
 #include "Ship.h"
+#include "RuleSet.h"
+#include <algorithm>
 #include <iostream>
 #include <set>
 using namespace std;
 
 Ship::Ship(const GridPosition &bow, const GridPosition &stern)
     : bow{bow}, stern{stern} {
-    cout << "Bow position of the ship: " << bow << endl;
-    cout << "Stern Position of the ship: " << stern << endl;
 }
 
 bool Ship::isValid() const {
-    if ((bow.isValid() && stern.isValid() && length() >= 2 && length() <= 5)
-        && ((stern.getColumn() == bow.getColumn())
-            || (stern.getRow() == bow.getRow()))) {
-        return true;
-    } else {
-        if (bow.isValid() == false || stern.isValid() == false) {
-            cout << "Ship is out of grid boundaries" << endl;
-        } else if ((length() >= 2 && length() <= 5) == false) {
-            cout << "Ship length is not between 2 or 5" << endl;
-            if (length() == -1) {
-                cout << "Field occupied by ship is not in a straight line"
-                		<< endl;
-            }
-        } else if ((stern.getColumn() != bow.getColumn())
-                || (stern.getRow() != bow.getRow())) {
-            cout << "Ship is not positioned horizontally or vertically" << endl;
-        }
-        return false;
+    return validate().isValid();
+}
+
+PlacementResult Ship::validate() const {
+    int shipLength = length();
+    if (bow.isValid() == false || stern.isValid() == false) {
+        return PlacementResult{PlacementResult::OUT_OF_BOUNDS, shipLength};
+    } else if (shipLength == -1) {
+        return PlacementResult{PlacementResult::NOT_STRAIGHT, shipLength};
+    } else if (shipLength < MIN_LENGTH || shipLength > MAX_LENGTH) {
+        return PlacementResult{PlacementResult::BAD_LENGTH, shipLength};
     }
+    return PlacementResult{PlacementResult::VALID, shipLength};
 }
 
 int Ship::length() const {
@@ -105,6 +99,15 @@ set<GridPosition> Ship::occupiedArea() const {
 }
 
 set<GridPosition> Ship::blockedArea() const {
+    return blockedArea(STANDARD_RULES);
+}
+
+set<GridPosition> Ship::blockedArea(const RuleSet& rules) const {
+    if (rules.mayShipsTouch()) {
+        // Ships may touch, only the occupied positions are blocked
+        return occupiedArea();
+    }
+
     set<GridPosition> shipBlockedPos; // Set to hold the result
     // Directions for 8 possible surrounding positions (vertical, horizontal,
     // and diagonal).
@@ -133,8 +136,8 @@ set<GridPosition> Ship::blockedArea() const {
             int yNewPosition = occupiedPos.getColumn() + dy;
 
             // Check if the new position is within grid boundaries
-            if (xNewPosition >= 65 && xNewPosition <= 74 &&
-            		yNewPosition > 0 && yNewPosition <= 10) {
+            if (GridPosition(char(xNewPosition), yNewPosition).isInside(
+            		rules.getRows(), rules.getColumns())) {
                 // Insert the surrounding position if valid
                 shipBlockedPos.insert(GridPosition(xNewPosition, yNewPosition));
             } else {
@@ -145,6 +148,61 @@ set<GridPosition> Ship::blockedArea() const {
     return shipBlockedPos;
 }
 
+Bitboard Ship::occupiedMask(const RuleSet& rules) const {
+    int rows = rules.getRows();
+    int columns = rules.getColumns();
+    Bitboard shipOccupiedMask;
+    if (length() < 0) {
+        // Not straight, no well defined area
+        return shipOccupiedMask;
+    }
+
+    int firstRow = min(bow.getRow(), stern.getRow()) - 'A';
+    int lastRow = max(bow.getRow(), stern.getRow()) - 'A';
+    int firstColumn = min(bow.getColumn(), stern.getColumn()) - 1;
+    int lastColumn = max(bow.getColumn(), stern.getColumn()) - 1;
+
+    for (int rowIndex = max(firstRow, 0); rowIndex <= min(lastRow, rows - 1);
+    		rowIndex++) {
+        for (int columnIndex = max(firstColumn, 0);
+        		columnIndex <= min(lastColumn, columns - 1); columnIndex++) {
+            shipOccupiedMask |= Bitboard::cell(CellIndex::fromRowColumn(
+            		rowIndex, columnIndex, columns));
+        }
+    }
+    return shipOccupiedMask;
+}
+
+Bitboard Ship::blockedMask(const RuleSet& rules) const {
+    Bitboard shipBlockedMask;
+    if (length() < 0) {
+        // Not straight, no well defined area
+        return shipBlockedMask;
+    }
+    if (rules.mayShipsTouch()) {
+        // Ships may touch, only the occupied cells are blocked
+        return occupiedMask(rules);
+    }
+    int rows = rules.getRows();
+    int columns = rules.getColumns();
+
+    // The blocked area of a straight ship is the rectangle around it
+    int firstRow = min(bow.getRow(), stern.getRow()) - 'A' - 1;
+    int lastRow = max(bow.getRow(), stern.getRow()) - 'A' + 1;
+    int firstColumn = min(bow.getColumn(), stern.getColumn()) - 2;
+    int lastColumn = max(bow.getColumn(), stern.getColumn());
+
+    for (int rowIndex = max(firstRow, 0); rowIndex <= min(lastRow, rows - 1);
+    		rowIndex++) {
+        for (int columnIndex = max(firstColumn, 0);
+        		columnIndex <= min(lastColumn, columns - 1); columnIndex++) {
+            shipBlockedMask |= Bitboard::cell(CellIndex::fromRowColumn(
+            		rowIndex, columnIndex, columns));
+        }
+    }
+    return shipBlockedMask;
+}
+
 ostream& operator<<(ostream &lhs, const set<GridPosition> &rhs) {
     lhs << "{"; // Start with the curly braces
     for (const auto& pos : rhs) {
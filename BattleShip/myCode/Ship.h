@@ -17,9 +17,13 @@
 #ifndef SHIP_H_
 #define SHIP_H_
 
+#include "Bitboard.h"
 #include "GridPosition.h"
+#include "PlacementResult.h"
 #include <set>
 
+class RuleSet;
+
 /**
  * @class Ship
  * @brief Class representing a ship with a bow and stern.
@@ -31,6 +35,10 @@
  *          occupies.
  */
 class Ship {
+public:
+    static constexpr int MIN_LENGTH = 2; ///< Length of the shortest ship.
+    static constexpr int MAX_LENGTH = 5; ///< Length of the longest ship.
+
 private:
     GridPosition bow;  ///< Front position (bow) of the ship on the grid.
     GridPosition stern; ///< Back position (stern) of the ship on the grid.
@@ -49,6 +57,15 @@ public:
      */
     bool isValid() const;
 
+    /**
+     * @brief Validates the ship without any console output.
+     * @details Checks, in this order, that bow and stern are valid grid
+     *          positions, that the ship is straight and that its length is
+     *          between MIN_LENGTH and MAX_LENGTH.
+     * @return VALID, OUT_OF_BOUNDS, NOT_STRAIGHT or BAD_LENGTH.
+     */
+    PlacementResult validate() const;
+
     /**
      * @brief Calculates the length of the ship based on its bow and stern
      *        positions.
@@ -65,11 +82,40 @@ public:
 
     /**
      * @brief Returns a set of grid positions that are blocked by the ship.
+     * @details Uses the bounds and touching rule of the standard rules.
      * @return A set of `GridPosition` objects representing the blocked grid
      *         positions.
      */
     std::set<GridPosition> blockedArea() const;
 
+    /**
+     * @brief Returns a set of grid positions that are blocked by the ship.
+     * @details Occupied positions plus their neighbours on the board of the
+     *          given rules; only the occupied positions if ships may touch.
+     * @param rules The rules that define the board and touching rule.
+     * @return A set of `GridPosition` objects representing the blocked grid
+     *         positions.
+     */
+    std::set<GridPosition> blockedArea(const RuleSet& rules) const;
+
+    /**
+     * @brief Returns the cells occupied by the ship as a bit mask.
+     * @details Same cells as occupiedArea(), without building a set. Cells
+     *          outside the board are left out.
+     * @param rules The rules that define the board.
+     * @return The occupied cells, empty if the ship is not straight.
+     */
+    Bitboard occupiedMask(const RuleSet& rules) const;
+
+    /**
+     * @brief Returns the cells blocked by the ship as a bit mask.
+     * @details Same cells as blockedArea(rules), clipped to the board,
+     *          without building a set.
+     * @param rules The rules that define the board and touching rule.
+     * @return The blocked cells, empty if the ship is not straight.
+     */
+    Bitboard blockedMask(const RuleSet& rules) const;
+
     /**
      * @brief Getter to retrieve the bow position of the ship.
      * @return The bow position (GridPosition).
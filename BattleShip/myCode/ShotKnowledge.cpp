@@ -0,0 +1,111 @@
+/**
+ * @file ShotKnowledge.cpp
+ * @brief Implementation file for the ShotKnowledge class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "ShotKnowledge.h"
+
+using namespace std;
+
+/**
+ * @brief Default constructor for an empty record.
+ */
+ShotKnowledge::ShotKnowledge() {
+}
+
+/**
+ * @brief Constructor to read a shot record.
+ *
+ * @details Shots outside the grid are ignored.
+ *
+ * @param shots The impact of each shot, as in OpponentGrid::getShots().
+ * @param rows The number of rows of the grid.
+ * @param columns The number of columns of the grid.
+ */
+ShotKnowledge::ShotKnowledge(const map<GridPosition, Shot::Impact>& shots,
+        int rows, int columns) {
+    for (const auto& shot : shots) {
+        if (shot.first.isInside(rows, columns) == false) {
+            continue;
+        }
+        Bitboard cell = Bitboard::cell(CellIndex::fromPosition(shot.first,
+                columns));
+        switch (shot.second) {
+        case Shot::Impact::NONE:
+            misses |= cell;
+            break;
+        case Shot::Impact::SUNKEN:
+            sunk |= cell;
+            hits |= cell;
+            break;
+        default:
+            hits |= cell;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Constructor to read the shot record of an opponent's grid.
+ *
+ * @details The cells the grid inferred to be water count as misses.
+ *
+ * @param grid The grid with the results of the player's shots.
+ */
+ShotKnowledge::ShotKnowledge(const OpponentGrid& grid)
+    : misses{grid.getWaterMask()}, hits{grid.getHitMask()},
+      sunk{grid.getStateMask(OpponentGrid::SUNK)} {
+}
+
+/**
+ * @brief Constructor to use given cell masks.
+ *
+ * @param misses The cells no ship may cover.
+ * @param hits The cells a ship must cover; must include sunk.
+ * @param sunk The cells whose ship must be completely hit.
+ */
+ShotKnowledge::ShotKnowledge(Bitboard misses, Bitboard hits, Bitboard sunk)
+    : misses{misses}, hits{hits}, sunk{sunk} {
+}
+
+/**
+ * @brief Getter method to retrieve the missed cells.
+ *
+ * @return The cells reported as NONE.
+ */
+Bitboard ShotKnowledge::getMisses() const {
+    return misses;
+}
+
+/**
+ * @brief Getter method to retrieve the hit cells.
+ *
+ * @return The cells reported as HIT or SUNKEN.
+ */
+Bitboard ShotKnowledge::getHits() const {
+    return hits;
+}
+
+/**
+ * @brief Getter method to retrieve the sunk cells.
+ *
+ * @return The cells reported as SUNKEN.
+ */
+Bitboard ShotKnowledge::getSunk() const {
+    return sunk;
+}
+
+/**
+ * @brief Checks whether nothing is known yet.
+ *
+ * @return true if the record is empty.
+ */
+bool ShotKnowledge::isEmpty() const {
+    return (misses | hits).none();
+}
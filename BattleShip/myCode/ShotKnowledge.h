@@ -0,0 +1,125 @@
+/**
+ * @file ShotKnowledge.h
+ * @brief Header file for the ShotKnowledge class, the constraints a shot
+ *        record puts on the opponent's fleet layout.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef SHOTKNOWLEDGE_H_
+#define SHOTKNOWLEDGE_H_
+
+#include "Bitboard.h"
+#include "OpponentGrid.h"
+#include "PlacementTable.h"
+#include <map>
+
+/**
+ * @class ShotKnowledge
+ * @brief Missed, hit and sunk cells of a shot record as bit masks.
+ *
+ * @details A layout is consistent with the record if
+ *          - no ship covers a missed cell,
+ *          - every hit cell (HIT or SUNKEN) is covered by a ship, and
+ *          - a ship covers a cell reported SUNKEN exactly if all its cells
+ *            were hit (the shot that completes a ship reports SUNKEN).
+ *          The first and last rule only depend on a single placement, see
+ *          allows(); the second one needs the whole layout, see covers().
+ */
+class ShotKnowledge {
+private:
+    Bitboard misses; ///< Cells reported as NONE.
+    Bitboard hits;   ///< Cells reported as HIT or SUNKEN.
+    Bitboard sunk;   ///< Cells reported as SUNKEN.
+
+public:
+    /**
+     * @brief Default constructor for an empty record.
+     */
+    ShotKnowledge();
+
+    /**
+     * @brief Constructor to read a shot record.
+     *
+     * @param shots The impact of each shot, as in OpponentGrid::getShots().
+     * @param rows The number of rows of the grid.
+     * @param columns The number of columns of the grid.
+     */
+    ShotKnowledge(const std::map<GridPosition, Shot::Impact>& shots,
+            int rows, int columns);
+
+    /**
+     * @brief Constructor to read the shot record of an opponent's grid.
+     *
+     * @details The cells the grid inferred to be water count as misses.
+     *
+     * @param grid The grid with the results of the player's shots.
+     */
+    explicit ShotKnowledge(const OpponentGrid& grid);
+
+    /**
+     * @brief Constructor to use given cell masks.
+     *
+     * @param misses The cells no ship may cover.
+     * @param hits The cells a ship must cover; must include sunk.
+     * @param sunk The cells whose ship must be completely hit.
+     */
+    ShotKnowledge(Bitboard misses, Bitboard hits, Bitboard sunk);
+
+    /**
+     * @brief Getter method to retrieve the missed cells.
+     *
+     * @return The cells reported as NONE.
+     */
+    Bitboard getMisses() const;
+
+    /**
+     * @brief Getter method to retrieve the hit cells.
+     *
+     * @return The cells reported as HIT or SUNKEN.
+     */
+    Bitboard getHits() const;
+
+    /**
+     * @brief Getter method to retrieve the sunk cells.
+     *
+     * @return The cells reported as SUNKEN.
+     */
+    Bitboard getSunk() const;
+
+    /**
+     * @brief Checks whether nothing is known yet.
+     *
+     * @return true if the record is empty.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Checks whether a placement can be part of a consistent layout.
+     *
+     * @param placement The placement of a ship.
+     * @return true if it covers no miss and covers a sunk cell exactly if
+     *         all its cells are hit.
+     */
+    bool allows(const Placement& placement) const {
+        return placement.occupied.intersects(misses) == false
+                && placement.occupied.intersects(sunk)
+                    == placement.occupied.isSubsetOf(hits);
+    }
+
+    /**
+     * @brief Checks whether the cells of a layout cover all hits.
+     *
+     * @param occupied The cells covered by all ships of a layout.
+     * @return true if no hit cell is left uncovered.
+     */
+    bool covers(const Bitboard& occupied) const {
+        return hits.isSubsetOf(occupied);
+    }
+};
+
+#endif /* SHOTKNOWLEDGE_H_ */
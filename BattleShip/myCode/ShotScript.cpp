@@ -0,0 +1,149 @@
+/**
+ * @file ShotScript.cpp
+ * @brief Implementation file for the ShotScript class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "ShotScript.h"
+#include "MappedFile.h"
+
+using namespace std;
+
+/**
+ * @brief Checks whether a character separates two coordinates.
+ *
+ * @param character The character to check.
+ * @return True for whitespace, commas and semicolons.
+ */
+static bool isSeparator(char character) {
+    return character == ' ' || character == '\t' || character == '\n'
+            || character == '\r' || character == ',' || character == ';';
+}
+
+/**
+ * @brief Counts the coordinates in a text without parsing them.
+ *
+ * @param text The text to scan.
+ * @return The number of tokens outside comments.
+ */
+static size_t countTokens(string_view text) {
+    size_t tokens = 0;
+    bool inToken = false;
+    bool inComment = false;
+    for (char character : text) {
+        if (inComment) {
+            inComment = character != '\n';
+        } else if (character == '#') {
+            inComment = true;
+            inToken = false;
+        } else if (isSeparator(character)) {
+            inToken = false;
+        } else if (!inToken) {
+            inToken = true;
+            tokens++;
+        }
+    }
+    return tokens;
+}
+
+/**
+ * @brief Default constructor creating an empty script.
+ */
+ShotScript::ShotScript() : errorOffset{0}, errorReason{GridPosition::OK} {
+}
+
+/**
+ * @brief Parses coordinates from text, replacing the current contents.
+ *
+ * @details Walks the text once; every token is handed to
+ *          GridPosition::parse() as a view into the input, so no string is
+ *          ever copied. A first pass counts the tokens, so the vector is
+ *          reserved for exactly the coordinates of the text.
+ *
+ * @param text The text to parse.
+ * @return OK on success, SYNTAX_ERROR if a token is invalid.
+ */
+ShotScript::Status ShotScript::parse(std::string_view text) {
+    positions.clear();
+    positions.reserve(countTokens(text));
+    errorOffset = text.size();
+    errorReason = GridPosition::OK;
+
+    size_t charIndex = 0;
+    while (charIndex < text.size()) {
+        char character = text[charIndex];
+        if (isSeparator(character)) {
+            charIndex++;
+        } else if (character == '#') {
+            // Skip the comment up to the end of the line
+            while (charIndex < text.size() && text[charIndex] != '\n') {
+                charIndex++;
+            }
+        } else {
+            size_t tokenStart = charIndex;
+            while (charIndex < text.size() && !isSeparator(text[charIndex])
+                    && text[charIndex] != '#') {
+                charIndex++;
+            }
+            GridPosition position{'A', 1};
+            GridPosition::ParseResult result = GridPosition::parse(
+                    text.substr(tokenStart, charIndex - tokenStart), position);
+            if (result != GridPosition::OK) {
+                errorOffset = tokenStart;
+                errorReason = result;
+                return SYNTAX_ERROR;
+            }
+            positions.push_back(position);
+        }
+    }
+    return OK;
+}
+
+/**
+ * @brief Maps a file and parses its coordinates.
+ *
+ * @param path Path of the file to load.
+ * @return OK on success, FILE_ERROR or SYNTAX_ERROR otherwise.
+ */
+ShotScript::Status ShotScript::load(const std::string& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        positions.clear();
+        errorOffset = 0;
+        errorReason = GridPosition::OK;
+        return FILE_ERROR;
+    }
+    return parse(file.view());
+}
+
+/**
+ * @brief Getter method to retrieve the parsed coordinates.
+ *
+ * @return A constant reference to the coordinates in script order.
+ */
+const std::vector<GridPosition>& ShotScript::getPositions() const {
+    return positions;
+}
+
+/**
+ * @brief Getter method to retrieve where parsing failed.
+ *
+ * @return Byte offset of the first invalid token, or the text length.
+ */
+std::size_t ShotScript::getErrorOffset() const {
+    return errorOffset;
+}
+
+/**
+ * @brief Getter method to retrieve why parsing failed.
+ *
+ * @return The parse result of the first invalid token, or OK.
+ */
+GridPosition::ParseResult ShotScript::getErrorReason() const {
+    return errorReason;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file ShotScript.h
+ * @brief Header file for the ShotScript class, a bulk loader for lists of
+ *        grid positions.
+ *
+ * @details Recorded shot sequences and fleet layouts are stored as plain text
+ *          lists of coordinates such as "A1 B2, J10". ShotScript parses such
+ *          text straight from a memory-mapped file into one contiguous
+ *          vector, using the non-throwing GridPosition::parse(). Reusing the
+ *          same ShotScript object for several files keeps the vector's
+ *          capacity, so steady-state loading does not allocate.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef SHOTSCRIPT_H_
+#define SHOTSCRIPT_H_
+
+#include "GridPosition.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ShotScript
+ * @brief Parses whitespace or comma separated coordinate lists.
+ *
+ * @details Coordinates may be separated by spaces, tabs, line breaks, commas
+ *          or semicolons. A '#' starts a comment that runs to the end of the
+ *          line.
+ */
+class ShotScript {
+public:
+    /**
+     * @enum Status
+     * @brief Enum to represent the outcome of loading a script.
+     *
+     * - OK: All coordinates were parsed.
+     * - FILE_ERROR: The file could not be opened or mapped.
+     * - SYNTAX_ERROR: A token is not a valid coordinate.
+     */
+    enum Status {
+        OK,           /**< Script loaded completely */
+        FILE_ERROR,   /**< File could not be opened or mapped */
+        SYNTAX_ERROR  /**< A token is not a valid coordinate */
+    };
+
+private:
+    std::vector<GridPosition> positions; ///< Parsed coordinates in order.
+    std::size_t errorOffset; ///< Byte offset of the first invalid token.
+    GridPosition::ParseResult errorReason; ///< Why that token was rejected.
+
+public:
+    /**
+     * @brief Default constructor creating an empty script.
+     */
+    ShotScript();
+
+    /**
+     * @brief Parses coordinates from text, replacing the current contents.
+     * @details Parsing stops at the first invalid token; the coordinates
+     *          before it are kept.
+     * @param text The text to parse.
+     * @return OK on success, SYNTAX_ERROR if a token is invalid.
+     */
+    Status parse(std::string_view text);
+
+    /**
+     * @brief Maps a file and parses its coordinates.
+     * @param path Path of the file to load.
+     * @return OK on success, FILE_ERROR or SYNTAX_ERROR otherwise.
+     */
+    Status load(const std::string& path);
+
+    /**
+     * @brief Getter method to retrieve the parsed coordinates.
+     * @return A constant reference to the coordinates in script order.
+     */
+    const std::vector<GridPosition>& getPositions() const;
+
+    /**
+     * @brief Getter method to retrieve where parsing failed.
+     * @return Byte offset of the first invalid token, or the text length if
+     *         parsing succeeded.
+     */
+    std::size_t getErrorOffset() const;
+
+    /**
+     * @brief Getter method to retrieve why parsing failed.
+     * @return The parse result of the first invalid token, or OK.
+     */
+    GridPosition::ParseResult getErrorReason() const;
+};
+
+#endif /* SHOTSCRIPT_H_ */
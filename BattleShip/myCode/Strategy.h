@@ -0,0 +1,188 @@
+/**
+ * @file Strategy.h
+ * @brief Header file for the strategy interface of the players and the
+ *        AnyStrategy wrapper.
+ *
+ * @details A strategy is any class with these member functions:
+ *          - bool placeFleet(OwnGrid& grid): places the whole fleet on an
+ *            empty grid and returns false if it could not.
+ *          - CellIndex nextShot(const OpponentGrid& grid): chooses the next
+ *            target from the results of the own shots so far.
+ *          - void observe(CellIndex target, Shot::Impact impact): receives
+ *            the result of the last shot after it was recorded in the grid.
+ *
+ *          A strategy that keeps state from one game to the next may also
+ *          have void reset(), which forgets that state. Tournament calls it
+ *          before every match, so that a match only depends on the Random
+ *          the strategy draws from.
+ *
+ *          MatchEngine::play() is a template over the strategies, so these
+ *          calls are resolved at compile time and can be inlined. The grids
+ *          are passed by reference; strategies should read them through
+ *          their bit masks (OpponentGrid::getStateMask(),
+ *          OwnGrid::getShotMask()), which neither copy nor allocate.
+ *          AnyStrategy holds any strategy chosen at run time, at the cost of
+ *          one indirect call per hook.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef STRATEGY_H_
+#define STRATEGY_H_
+
+#include "CellIndex.h"
+#include "OpponentGrid.h"
+#include "OwnGrid.h"
+#include "Shot.h"
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Checks whether a class has the member functions of a strategy.
+ *
+ * @details isStrategy<T>::value is true if T can be used as a strategy; see
+ *          the file description.
+ */
+template <class T, class = void>
+struct isStrategy : std::false_type {
+};
+
+/// Specialization for the classes that have all three hooks.
+template <class T>
+struct isStrategy<T, std::void_t<
+        decltype(bool(std::declval<T&>().placeFleet(
+                std::declval<OwnGrid&>()))),
+        decltype(CellIndex(std::declval<T&>().nextShot(
+                std::declval<const OpponentGrid&>()))),
+        decltype(std::declval<T&>().observe(std::declval<CellIndex>(),
+                std::declval<Shot::Impact>()))>> : std::true_type {
+};
+
+/**
+ * @brief Checks whether a strategy has the optional reset() hook.
+ */
+template <class T, class = void>
+struct hasReset : std::false_type {
+};
+
+/// Specialization for the classes that have reset().
+template <class T>
+struct hasReset<T, std::void_t<decltype(std::declval<T&>().reset())>>
+        : std::true_type {
+};
+
+/**
+ * @class AnyStrategy
+ * @brief Holds a strategy of any type chosen at run time.
+ *
+ * @details AnyStrategy is itself a strategy. It owns the wrapped strategy
+ *          and can be moved but not copied.
+ */
+class AnyStrategy {
+private:
+    /**
+     * @struct Concept
+     * @brief The hooks of the wrapped strategy.
+     */
+    struct Concept {
+        virtual ~Concept() = default;
+        virtual bool placeFleet(OwnGrid& grid) = 0;
+        virtual CellIndex nextShot(const OpponentGrid& grid) = 0;
+        virtual void observe(CellIndex target, Shot::Impact impact) = 0;
+        virtual void reset() = 0;
+    };
+
+    /**
+     * @struct Model
+     * @brief Forwards the hooks to a strategy of type T.
+     */
+    template <class T>
+    struct Model final : Concept {
+        T strategy; ///< The wrapped strategy.
+
+        explicit Model(T&& strategy) : strategy{std::move(strategy)} {
+        }
+
+        bool placeFleet(OwnGrid& grid) override {
+            return strategy.placeFleet(grid);
+        }
+
+        CellIndex nextShot(const OpponentGrid& grid) override {
+            return strategy.nextShot(grid);
+        }
+
+        void observe(CellIndex target, Shot::Impact impact) override {
+            strategy.observe(target, impact);
+        }
+
+        void reset() override {
+            if constexpr (hasReset<T>::value) {
+                strategy.reset();
+            }
+        }
+    };
+
+    std::unique_ptr<Concept> self; ///< The wrapped strategy.
+
+public:
+    /**
+     * @brief Constructor to wrap a strategy.
+     *
+     * @param strategy The strategy; it is moved into the wrapper.
+     */
+    template <class T, class = std::enable_if_t<
+            !std::is_same<std::decay_t<T>, AnyStrategy>::value
+            && isStrategy<std::decay_t<T>>::value>>
+    AnyStrategy(T&& strategy)
+        : self{std::make_unique<Model<std::decay_t<T>>>(
+                std::decay_t<T>(std::forward<T>(strategy)))} {
+    }
+
+    AnyStrategy(AnyStrategy&&) = default;
+    AnyStrategy& operator=(AnyStrategy&&) = default;
+
+    /**
+     * @brief Places the whole fleet on an empty grid.
+     *
+     * @param grid The empty grid.
+     * @return false if the fleet could not be placed.
+     */
+    bool placeFleet(OwnGrid& grid) {
+        return self->placeFleet(grid);
+    }
+
+    /**
+     * @brief Chooses the next target.
+     *
+     * @param grid The results of the own shots so far.
+     * @return The cell to shoot at.
+     */
+    CellIndex nextShot(const OpponentGrid& grid) {
+        return self->nextShot(grid);
+    }
+
+    /**
+     * @brief Receives the result of the last shot.
+     *
+     * @param target The cell that was shot.
+     * @param impact The impact of the shot.
+     */
+    void observe(CellIndex target, Shot::Impact impact) {
+        self->observe(target, impact);
+    }
+
+    /**
+     * @brief Forgets the state of earlier games, if the wrapped strategy
+     *        keeps any.
+     */
+    void reset() {
+        self->reset();
+    }
+};
+
+#endif /* STRATEGY_H_ */
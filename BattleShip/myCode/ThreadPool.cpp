@@ -0,0 +1,246 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation file for the ThreadPool class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Constructor to start the worker threads.
+ *
+ * @param size Number of workers including the calling thread; 0 means one
+ *        per hardware thread.
+ */
+ThreadPool::ThreadPool(unsigned size)
+    : task{nullptr}, taskOffset{0}, busy{0}, generation{0},
+      stopping{false} {
+    if (size == 0) {
+        size = max(1u, thread::hardware_concurrency());
+    }
+    ranges = make_unique<Range[]>(size);
+    threads.reserve(size - 1);
+    for (unsigned worker = 1; worker < size; worker++) {
+        threads.emplace_back(&ThreadPool::work, this, worker);
+    }
+}
+
+/**
+ * @brief Destructor to stop and join the worker threads.
+ */
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+    wake.notify_all();
+    for (thread& worker : threads) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Getter method to retrieve the number of workers.
+ *
+ * @return Number of workers including the calling thread.
+ */
+unsigned ThreadPool::size() const {
+    return static_cast<unsigned>(threads.size()) + 1;
+}
+
+/**
+ * @brief Splits packed range bounds.
+ *
+ * @param bounds First task number in the low, end in the high 32 bits.
+ * @param first Receives the first task number.
+ * @param end Receives the end of the range.
+ */
+static void unpack(uint64_t bounds, uint64_t& first, uint64_t& end) {
+    first = bounds & UINT32_MAX;
+    end = bounds >> 32;
+}
+
+/**
+ * @brief Takes the first task of a worker's own range.
+ *
+ * @param worker The number of the worker.
+ * @param number Receives the task number.
+ * @return false if the range is empty.
+ */
+bool ThreadPool::take(unsigned worker, uint64_t& number) {
+    // The batch itself is published under the mutex, so the bounds only
+    // need to be updated atomically
+    atomic<uint64_t>& bounds = ranges[worker].bounds;
+    uint64_t current = bounds.load(memory_order_relaxed);
+    while (true) {
+        uint64_t first;
+        uint64_t end;
+        unpack(current, first, end);
+        if (first >= end) {
+            return false;
+        }
+        if (bounds.compare_exchange_weak(current, current + 1,
+                memory_order_relaxed)) {
+            number = first;
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief Moves the back half of the fullest other range to a worker.
+ *
+ * @details Only the owner refills its own range, and only while it is
+ *          empty, so storing the stolen range needs no compare-and-swap.
+ *
+ * @param worker The number of the idle worker.
+ * @param number Receives the first stolen task number.
+ * @return false if no other worker has tasks left.
+ */
+bool ThreadPool::steal(unsigned worker, uint64_t& number) {
+    unsigned workers = size();
+    while (true) {
+        unsigned victim = worker;
+        uint64_t most = 0;
+        for (unsigned step = 1; step < workers; step++) {
+            unsigned other = (worker + step) % workers;
+            uint64_t first;
+            uint64_t end;
+            unpack(ranges[other].bounds.load(memory_order_relaxed), first,
+                    end);
+            if (end > first && end - first > most) {
+                most = end - first;
+                victim = other;
+            }
+        }
+        if (most == 0) {
+            return false;
+        }
+
+        atomic<uint64_t>& bounds = ranges[victim].bounds;
+        uint64_t current = bounds.load(memory_order_relaxed);
+        uint64_t first;
+        uint64_t end;
+        unpack(current, first, end);
+        if (first >= end) {
+            continue;
+        }
+        uint64_t middle = first + (end - first) / 2;
+        if (bounds.compare_exchange_strong(current, first | middle << 32,
+                memory_order_relaxed)) {
+            number = middle;
+            ranges[worker].bounds.store((middle + 1) | end << 32,
+                    memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief Runs tasks of the current batch until none are left.
+ *
+ * @param worker The number of the running worker.
+ */
+void ThreadPool::drain(unsigned worker) {
+    uint64_t number;
+    while (take(worker, number) || steal(worker, number)) {
+        try {
+            (*task)(taskOffset + number, worker);
+        } catch (...) {
+            lock_guard<std::mutex> lock{mutex};
+            if (!failure) {
+                failure = current_exception();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Main loop of a worker thread.
+ *
+ * @param worker The number of the worker.
+ */
+void ThreadPool::work(unsigned worker) {
+    unsigned long seen = 0;
+    while (true) {
+        {
+            unique_lock<std::mutex> lock{mutex};
+            wake.wait(lock, [&] {
+                return stopping || generation != seen;
+            });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+        drain(worker);
+        {
+            lock_guard<std::mutex> lock{mutex};
+            busy--;
+        }
+        done.notify_one();
+    }
+}
+
+/**
+ * @brief Runs a batch of tasks and waits until all are finished.
+ *
+ * @param count Number of tasks, numbered 0 to count - 1.
+ * @param task The work to do for each task number.
+ * @throws The first exception thrown by a task, after the batch ended.
+ */
+void ThreadPool::run(size_t count, const Task& task) {
+    size_t offset = 0;
+    do {
+        size_t batch = min(count - offset, MAX_BATCH);
+        runBatch(offset, batch, task);
+        offset += batch;
+    } while (offset < count);
+}
+
+/**
+ * @brief Runs up to MAX_BATCH tasks and waits until all are finished.
+ *
+ * @param offset Number of the first task.
+ * @param count Number of tasks.
+ * @param task The work to do for each task number.
+ * @throws The first exception thrown by a task, after the batch ended.
+ */
+void ThreadPool::runBatch(size_t offset, size_t count, const Task& task) {
+    {
+        lock_guard<std::mutex> lock{mutex};
+        this->task = &task;
+        taskOffset = offset;
+
+        // Contiguous ranges keep neighbouring tasks on one worker
+        uint64_t workers = size();
+        for (uint64_t worker = 0; worker < workers; worker++) {
+            uint64_t first = count * worker / workers;
+            uint64_t end = count * (worker + 1) / workers;
+            ranges[worker].bounds.store(first | end << 32,
+                    memory_order_relaxed);
+        }
+        busy = static_cast<unsigned>(threads.size());
+        failure = nullptr;
+        generation++;
+    }
+    wake.notify_all();
+    drain(0);
+
+    unique_lock<std::mutex> lock{mutex};
+    done.wait(lock, [this] {
+        return busy == 0;
+    });
+    this->task = nullptr;
+    if (failure) {
+        rethrow_exception(failure);
+    }
+}
@@ -0,0 +1,150 @@
+/**
+ * @file ThreadPool.h
+ * @brief Header file for the ThreadPool class, a fixed set of worker
+ *        threads for parallel searches and simulations.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Runs batches of independent tasks on persistent worker threads.
+ *
+ * @details The threads are started once and wait between batches. Each
+ *          batch is split into one contiguous range of task numbers per
+ *          worker, including the calling thread. A worker takes tasks from
+ *          the front of its own range; when it is empty, it steals the back
+ *          half of the fullest other range. Workers only touch their own
+ *          cache line until they run out of work, so the pool scales to many
+ *          cores, and short and long tasks still balance themselves.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief A task of a batch.
+     * @details Receives the task number and the number of the worker that
+     *          runs it (0 to size() - 1), which indexes per-worker state.
+     */
+    using Task = std::function<void(std::size_t task, unsigned worker)>;
+
+    /// Largest number of tasks scheduled at once; run() splits larger
+    /// batches.
+    static constexpr std::size_t MAX_BATCH = UINT32_MAX;
+
+private:
+    /**
+     * @struct Range
+     * @brief The task numbers a worker has left, on their own cache line.
+     * @details Packs the first task number in the low and the end in the
+     *          high 32 bits, so owner and thieves update it with one
+     *          compare-and-swap.
+     */
+    struct alignas(64) Range {
+        std::atomic<std::uint64_t> bounds{0}; ///< first | end << 32
+    };
+
+    std::vector<std::thread> threads; ///< The workers besides the caller.
+    std::unique_ptr<Range[]> ranges; ///< Tasks left of each worker.
+    std::mutex mutex; ///< Protects the batch state below.
+    std::condition_variable wake; ///< Signals a new batch or shutdown.
+    std::condition_variable done; ///< Signals the end of a worker's batch.
+    const Task* task; ///< The task of the current batch.
+    std::size_t taskOffset; ///< Added to the range numbers of the batch.
+    unsigned busy; ///< Threads still working on the current batch.
+    unsigned long generation; ///< Number of the current batch.
+    bool stopping; ///< True when the threads should exit.
+    std::exception_ptr failure; ///< First exception thrown by a task.
+
+    /**
+     * @brief Takes the first task of a worker's own range.
+     * @param worker The number of the worker.
+     * @param number Receives the task number.
+     * @return false if the range is empty.
+     */
+    bool take(unsigned worker, std::uint64_t& number);
+
+    /**
+     * @brief Moves the back half of the fullest other range to a worker.
+     * @param worker The number of the idle worker.
+     * @param number Receives the first stolen task number.
+     * @return false if no other worker has tasks left.
+     */
+    bool steal(unsigned worker, std::uint64_t& number);
+
+    /**
+     * @brief Runs tasks of the current batch until none are left.
+     * @param worker The number of the running worker.
+     */
+    void drain(unsigned worker);
+
+    /**
+     * @brief Main loop of a worker thread.
+     * @param worker The number of the worker.
+     */
+    void work(unsigned worker);
+
+    /**
+     * @brief Runs up to MAX_BATCH tasks and waits until all are finished.
+     * @param offset Number of the first task.
+     * @param count Number of tasks.
+     * @param task The work to do for each task number.
+     */
+    void runBatch(std::size_t offset, std::size_t count, const Task& task);
+
+public:
+    /**
+     * @brief Constructor to start the worker threads.
+     *
+     * @param size Number of workers including the calling thread; 0 means
+     *        one per hardware thread.
+     */
+    explicit ThreadPool(unsigned size = 0);
+
+    /**
+     * @brief Destructor to stop and join the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Getter method to retrieve the number of workers.
+     *
+     * @return Number of workers including the calling thread.
+     */
+    unsigned size() const;
+
+    /**
+     * @brief Runs a batch of tasks and waits until all are finished.
+     *
+     * @details Must not be called from a task of the same pool. Tasks are
+     *          started in increasing order within each worker's range, but
+     *          in no particular order overall.
+     *
+     * @param count Number of tasks, numbered 0 to count - 1.
+     * @param task The work to do for each task number.
+     * @throws The first exception thrown by a task, after the batch ended.
+     */
+    void run(std::size_t count, const Task& task);
+};
+
+#endif /* THREADPOOL_H_ */
@@ -0,0 +1,303 @@
+/**
+ * @file Tournament.cpp
+ * @brief Implementation file for the Tournament class.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "Tournament.h"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+using namespace std;
+
+/**
+ * @struct TournamentWorker
+ * @brief Everything one worker changes while playing.
+ *
+ * @details A worker is created by its own thread. The counters live in one
+ *          vector with a cache line of padding at both ends, so they never
+ *          share a cache line with another worker's data.
+ */
+struct alignas(64) TournamentWorker {
+    /// Unused counters before and after the used ones.
+    static constexpr size_t PADDING = 64 / sizeof(long);
+
+    MatchEngine engine; ///< Plays this worker's matches.
+    std::vector<Random> randoms; ///< Random of each entrant's strategy.
+    std::vector<AnyStrategy> players; ///< Strategy of each entrant.
+    size_t entrants;      ///< Number of entrants.
+    size_t histogramSize; ///< Counters per shotsToWin histogram.
+    std::vector<long> counters; ///< Wins, losses, draws, pair wins and
+                                ///< histograms, padded.
+
+    /**
+     * @brief Constructor to create the strategies and empty counters.
+     * @param rules The rules of all matches.
+     * @param factories Creates the strategy of each entrant.
+     * @param maxShots Shots each player may fire in a match.
+     */
+    TournamentWorker(const RuleSet& rules,
+            const std::vector<Tournament::PlayerFactory>& factories,
+            int maxShots)
+        : engine{rules}, randoms(factories.size()),
+          entrants{factories.size()}, histogramSize(maxShots + 1),
+          counters(2 * PADDING + entrants * (3 + entrants + histogramSize)) {
+        engine.setMaxShots(maxShots);
+        players.reserve(entrants);
+        for (size_t entrant = 0; entrant < entrants; entrant++) {
+            players.push_back(factories[entrant](randoms[entrant]));
+        }
+    }
+
+    /// Wins of an entrant.
+    long& wins(size_t entrant) {
+        return counters[PADDING + entrant];
+    }
+
+    /// Losses of an entrant.
+    long& losses(size_t entrant) {
+        return counters[PADDING + entrants + entrant];
+    }
+
+    /// Draws of an entrant.
+    long& draws(size_t entrant) {
+        return counters[PADDING + 2 * entrants + entrant];
+    }
+
+    /// Wins of an entrant against another one.
+    long& pairWins(size_t winner, size_t loser) {
+        return counters[PADDING + (3 + winner) * entrants + loser];
+    }
+
+    /// Wins of an entrant with a number of shots fired.
+    long& shotsToWin(size_t entrant, int shots) {
+        return counters[PADDING + (3 + entrants) * entrants
+                + entrant * histogramSize + shots];
+    }
+
+    /**
+     * @brief Plays one match with the players' streams of a match number.
+     * @details Both players are reset first, so nothing carries over from
+     *          the worker's earlier matches.
+     * @param first The entrant who shoots first.
+     * @param second The other entrant.
+     * @param match Number of the match.
+     * @param seed Seed of the whole tournament.
+     * @return The result of the match.
+     */
+    MatchResult play(int first, int second, long match, std::uint64_t seed) {
+        randoms[first].seed(Random::streamSeed(seed, std::uint64_t(match),
+                Random::FIRST_PLAYER));
+        randoms[second].seed(Random::streamSeed(seed, std::uint64_t(match),
+                Random::SECOND_PLAYER));
+        players[first].reset();
+        players[second].reset();
+        return engine.play(players[first], players[second]);
+    }
+};
+
+/**
+ * @brief Constructor to create an empty tournament.
+ *
+ * @param rules The rules of all matches.
+ * @param format Which entrants play against each other.
+ * @throws std::invalid_argument if the rules are not valid.
+ */
+Tournament::Tournament(const RuleSet& rules, Format format) : rules{rules},
+        format{format}, gamesPerPairing{DEFAULT_GAMES_PER_PAIRING},
+        maxShots{MatchEngine::DEFAULT_MAX_SHOTS} {
+    if (rules.isValid() == false) {
+        throw invalid_argument("Tournament: rule set is not valid");
+    }
+}
+
+/**
+ * @brief Adds an entrant; in a gauntlet the first one is the challenger.
+ *
+ * @param name The name in the results.
+ * @param factory Creates the entrant's strategy.
+ */
+void Tournament::addEntrant(const std::string& name,
+        const PlayerFactory& factory) {
+    names.push_back(name);
+    factories.push_back(factory);
+}
+
+/**
+ * @brief Sets the number of matches between two entrants.
+ *
+ * @param games Number of matches, at least 1.
+ */
+void Tournament::setGamesPerPairing(long games) {
+    gamesPerPairing = max(1L, games);
+}
+
+/**
+ * @brief Sets the number of shots each player may fire in a match.
+ *
+ * @param maxShots Number of shots, at least 1.
+ */
+void Tournament::setMaxShots(int maxShots) {
+    this->maxShots = max(1, maxShots);
+}
+
+/**
+ * @brief Getter method to retrieve the pairs of entrants that meet.
+ *
+ * @return The entrant numbers of each pairing.
+ */
+vector<pair<int, int>> Tournament::getPairings() const {
+    vector<pair<int, int>> pairings;
+    int entrants = static_cast<int>(names.size());
+    for (int first = 0; first < entrants; first++) {
+        for (int second = first + 1; second < entrants; second++) {
+            pairings.emplace_back(first, second);
+        }
+        if (format == GAUNTLET) {
+            break;
+        }
+    }
+    return pairings;
+}
+
+/**
+ * @brief Finds the entrants of a match in the order they shoot.
+ *
+ * @details Match n is game n % gamesPerPairing of pairing
+ *          n / gamesPerPairing; in even games the entrant added first
+ *          shoots first.
+ *
+ * @param pairings The pairs of entrants that meet.
+ * @param match Number of the match.
+ * @return The entrant who shoots first and the other one.
+ */
+pair<int, int> Tournament::getSeats(const vector<pair<int, int>>& pairings,
+        long match) const {
+    const pair<int, int>& pairing = pairings[match / gamesPerPairing];
+    if (match % gamesPerPairing % 2 == 1) {
+        return {pairing.second, pairing.first};
+    }
+    return pairing;
+}
+
+/**
+ * @brief Getter method to retrieve the number of matches of a run.
+ *
+ * @return The number of matches run() plays.
+ */
+long Tournament::getMatchCount() const {
+    return static_cast<long>(getPairings().size()) * gamesPerPairing;
+}
+
+/**
+ * @brief Plays all matches on the workers of a pool.
+ *
+ * @details The players of match n draw from the Random::stream() of seed
+ *          and n for their seat, see getSeats().
+ *
+ * @param pool The workers to use.
+ * @param seed Seed of the whole tournament.
+ * @return The results of all entrants.
+ */
+TournamentResult Tournament::run(ThreadPool& pool, uint64_t seed) const {
+    vector<pair<int, int>> pairings = getPairings();
+    size_t entrants = names.size();
+    long matches = static_cast<long>(pairings.size()) * gamesPerPairing;
+    int histogramSize = maxShots + 1;
+
+    // Each worker creates its own state on first use
+    vector<unique_ptr<TournamentWorker>> workers(pool.size());
+
+    long tasks = (matches + MATCHES_PER_TASK - 1) / MATCHES_PER_TASK;
+    pool.run(tasks, [&](size_t task, unsigned workerNumber) {
+        if (!workers[workerNumber]) {
+            workers[workerNumber] = make_unique<TournamentWorker>(rules,
+                    factories, maxShots);
+        }
+        TournamentWorker& worker = *workers[workerNumber];
+
+        long end = min(matches, long(task + 1) * MATCHES_PER_TASK);
+        for (long match = long(task) * MATCHES_PER_TASK; match < end;
+                match++) {
+            pair<int, int> seats = getSeats(pairings, match);
+            int first = seats.first;
+            int second = seats.second;
+            MatchResult result = worker.play(first, second, match, seed);
+            if (result.winner == MatchResult::NO_WINNER) {
+                worker.draws(first)++;
+                worker.draws(second)++;
+                continue;
+            }
+            int winner = result.winner == 0 ? first : second;
+            int loser = result.winner == 0 ? second : first;
+            worker.wins(winner)++;
+            worker.losses(loser)++;
+            worker.pairWins(winner, loser)++;
+            worker.shotsToWin(winner, result.shots[result.winner])++;
+        }
+    });
+
+    // Add up the counters of all workers
+    TournamentResult total;
+    total.games = matches;
+    total.entrants.resize(entrants);
+    total.pairWins.assign(entrants * entrants, 0);
+    for (size_t entrant = 0; entrant < entrants; entrant++) {
+        EntrantStats& stats = total.entrants[entrant];
+        stats.name = names[entrant];
+        stats.shotsToWin.assign(histogramSize, 0);
+        for (const auto& worker : workers) {
+            if (!worker) {
+                continue;
+            }
+            stats.wins += worker->wins(entrant);
+            stats.losses += worker->losses(entrant);
+            stats.draws += worker->draws(entrant);
+            for (int shots = 0; shots < histogramSize; shots++) {
+                stats.shotsToWin[shots] += worker->shotsToWin(entrant, shots);
+            }
+            for (size_t other = 0; other < entrants; other++) {
+                total.pairWins[entrant * entrants + other]
+                        += worker->pairWins(entrant, other);
+            }
+        }
+        stats.games = stats.wins + stats.losses + stats.draws;
+        if (stats.games > 0) {
+            stats.winRate = double(stats.wins) / stats.games;
+        }
+        double shotsFired = 0;
+        for (int shots = 0; shots < histogramSize; shots++) {
+            shotsFired += double(shots) * stats.shotsToWin[shots];
+        }
+        if (stats.wins > 0) {
+            stats.meanShotsToWin = shotsFired / stats.wins;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Plays one match of a run again on the calling thread.
+ *
+ * @param match Number of the match, below getMatchCount().
+ * @param seed Seed of the whole tournament.
+ * @param record Receives the fleets and moves; may be nullptr.
+ * @return The result of the match; player 0 shoots first.
+ * @throws std::out_of_range if there is no such match.
+ */
+MatchResult Tournament::playMatch(long match, uint64_t seed,
+        GameRecord* record) const {
+    if (match < 0 || match >= getMatchCount()) {
+        throw out_of_range("Tournament: no such match");
+    }
+    pair<int, int> seats = getSeats(getPairings(), match);
+    TournamentWorker worker{rules, factories, maxShots};
+    worker.engine.setRecord(record);
+    return worker.play(seats.first, seats.second, match, seed);
+}
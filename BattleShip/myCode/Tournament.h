@@ -0,0 +1,191 @@
+/**
+ * @file Tournament.h
+ * @brief Header file for the Tournament class, which plays many matches
+ *        between strategies on all cores.
+ *
+ * @details Matches are numbered and every match seeds its players from its
+ *          number alone, so the results do not depend on the number of
+ *          threads or on which thread played which match, and any match can
+ *          be played again on its own with playMatch().
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef TOURNAMENT_H_
+#define TOURNAMENT_H_
+
+#include "MatchEngine.h"
+#include "Random.h"
+#include "Strategy.h"
+#include "ThreadPool.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct EntrantStats
+ * @brief Results of one entrant of a tournament.
+ */
+struct EntrantStats {
+    std::string name; ///< Name of the entrant.
+    long games = 0;   ///< Matches played.
+    long wins = 0;    ///< Matches won.
+    long losses = 0;  ///< Matches lost.
+    long draws = 0;   ///< Matches without a winner.
+    double winRate = 0; ///< wins / games.
+    double meanShotsToWin = 0; ///< Average shots fired in the matches won.
+    std::vector<long> shotsToWin; ///< Number of wins with each number of
+                                  ///< shots fired, up to the shot limit.
+};
+
+/**
+ * @struct TournamentResult
+ * @brief Result of Tournament::run().
+ */
+struct TournamentResult {
+    long games = 0; ///< Matches played.
+    std::vector<EntrantStats> entrants; ///< Results of each entrant.
+    std::vector<long> pairWins; ///< Wins of entrant i against entrant j at
+                                ///< i * entrants.size() + j.
+};
+
+/**
+ * @class Tournament
+ * @brief Round robin or gauntlet tournament between strategies.
+ *
+ * @details An entrant is a factory that creates a strategy drawing all its
+ *          randomness from a given Random. Each worker creates every
+ *          strategy once; before every match it reseeds the Randoms and
+ *          calls the strategies' reset() (see Strategy.h), so a match only
+ *          depends on the seed and its number, whatever the worker played
+ *          before. Strategies that keep state between games must therefore
+ *          forget it in reset(); the built-in strategies do, including the
+ *          Markov chain of a UNIFORM_CHAIN placement.
+ *
+ *          Matches are handed to the ThreadPool in blocks of
+ *          MATCHES_PER_TASK. Every worker owns its engine, players and
+ *          counters on separate cache lines; they are added up after the
+ *          last match, so no lock is taken while playing.
+ */
+class Tournament {
+public:
+    /**
+     * @enum Format
+     * @brief Which entrants play against each other.
+     */
+    enum Format {
+        ROUND_ROBIN, /**< Every entrant against every other. */
+        GAUNTLET     /**< The first entrant against every other. */
+    };
+
+    /// Creates a strategy that uses random for all its decisions.
+    using PlayerFactory = std::function<AnyStrategy(Random& random)>;
+
+    static constexpr long DEFAULT_GAMES_PER_PAIRING = 1000; ///< Matches
+                                                 ///< between two entrants.
+    static constexpr long MATCHES_PER_TASK = 64; ///< Matches per pool task.
+
+private:
+    RuleSet rules;  ///< The rules of all matches.
+    Format format;  ///< Which entrants play against each other.
+    long gamesPerPairing; ///< Matches between two entrants.
+    int maxShots;   ///< Shots each player may fire in a match.
+    std::vector<std::string> names; ///< Name of each entrant.
+    std::vector<PlayerFactory> factories; ///< Strategy of each entrant.
+
+    /**
+     * @brief Getter method to retrieve the pairs of entrants that meet.
+     * @return The entrant numbers of each pairing.
+     */
+    std::vector<std::pair<int, int>> getPairings() const;
+
+    /**
+     * @brief Finds the entrants of a match in the order they shoot.
+     * @param pairings The pairs of entrants that meet.
+     * @param match Number of the match.
+     * @return The entrant who shoots first and the other one.
+     */
+    std::pair<int, int> getSeats(
+            const std::vector<std::pair<int, int>>& pairings,
+            long match) const;
+
+public:
+    /**
+     * @brief Constructor to create an empty tournament.
+     *
+     * @param rules The rules of all matches.
+     * @param format Which entrants play against each other.
+     * @throws std::invalid_argument if the rules are not valid.
+     */
+    explicit Tournament(const RuleSet& rules = STANDARD_RULES,
+            Format format = ROUND_ROBIN);
+
+    /**
+     * @brief Adds an entrant; in a gauntlet the first one is the challenger.
+     *
+     * @details The factory is called once per worker, possibly from
+     *          several threads at once.
+     *
+     * @param name The name in the results.
+     * @param factory Creates the entrant's strategy.
+     */
+    void addEntrant(const std::string& name, const PlayerFactory& factory);
+
+    /**
+     * @brief Sets the number of matches between two entrants.
+     *
+     * @details The entrants take turns at shooting first.
+     *
+     * @param games Number of matches, at least 1.
+     */
+    void setGamesPerPairing(long games);
+
+    /**
+     * @brief Sets the number of shots each player may fire in a match.
+     *
+     * @param maxShots Number of shots, at least 1.
+     */
+    void setMaxShots(int maxShots);
+
+    /**
+     * @brief Getter method to retrieve the number of matches of a run.
+     *
+     * @return The number of matches run() plays.
+     */
+    long getMatchCount() const;
+
+    /**
+     * @brief Plays all matches on the workers of a pool.
+     *
+     * @param pool The workers to use.
+     * @param seed Seed of the whole tournament; match n only depends on it
+     *        and on n.
+     * @return The results of all entrants.
+     */
+    TournamentResult run(ThreadPool& pool, std::uint64_t seed = 0) const;
+
+    /**
+     * @brief Plays one match of a run again on the calling thread.
+     *
+     * @details The players get the same Random streams as in run(), so the
+     *          match is the same as in a run with the same seed, e.g. to
+     *          debug it.
+     *
+     * @param match Number of the match, below getMatchCount().
+     * @param seed Seed of the whole tournament.
+     * @param record Receives the fleets and moves; may be nullptr.
+     * @return The result of the match; player 0 shoots first, which in
+     *         even games of a pairing is the entrant added first.
+     * @throws std::out_of_range if there is no such match.
+     */
+    MatchResult playMatch(long match, std::uint64_t seed = 0,
+            GameRecord* record = nullptr) const;
+};
+
+#endif /* TOURNAMENT_H_ */
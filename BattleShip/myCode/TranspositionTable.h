@@ -0,0 +1,168 @@
+/**
+ * @file TranspositionTable.h
+ * @brief Header file for the TranspositionTable class, a fixed-size cache
+ *        of search results by state hash that threads share without locks.
+ *
+ * @details Search threads reach the same grid state through different shot
+ *          orders; OwnGrid::getHash() and OpponentGrid::getHash() identify
+ *          these states, and the table keeps one result per hash, e.g. a
+ *          heat map or an evaluation.
+ *
+ *          Every slot is a sequence lock made of atomic 64 bit words: a
+ *          writer makes the sequence odd, stores the key and the value word
+ *          by word and makes it even again; a reader copies the words and
+ *          accepts them only if the sequence was even and unchanged. Readers
+ *          never wait, and a writer that finds a slot being written drops
+ *          its result instead of waiting. A lookup therefore either returns
+ *          a value that was stored for the key or misses.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef TRANSPOSITIONTABLE_H_
+#define TRANSPOSITIONTABLE_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @class TranspositionTable
+ * @brief Maps 64 bit state hashes to values of type Value.
+ *
+ * @details The table has a power of two number of slots; a hash goes to the
+ *          slot of its low bits and replaces what was stored there. All
+ *          members except clear() may be called by any number of threads at
+ *          the same time.
+ *
+ * @tparam Value The cached type; must be trivially copyable.
+ */
+template <class Value>
+class TranspositionTable {
+    static_assert(std::is_trivially_copyable<Value>::value,
+            "TranspositionTable: Value must be trivially copyable");
+
+public:
+    /// Words needed for one value.
+    static constexpr std::size_t WORDS = (sizeof(Value) + 7) / 8;
+
+private:
+    /**
+     * @struct Slot
+     * @brief One cached value with its key and sequence lock.
+     */
+    struct Slot {
+        /// Even when stable, odd while written; 0 if never written.
+        std::atomic<std::uint64_t> sequence;
+        std::atomic<std::uint64_t> key; ///< Hash of the cached state.
+        std::array<std::atomic<std::uint64_t>, WORDS> words; ///< The value.
+    };
+
+    std::unique_ptr<Slot[]> slots; ///< The slots, zero when created.
+    std::size_t mask; ///< Number of slots minus 1.
+
+    /**
+     * @brief Finds the slot of a hash.
+     * @param key The hash.
+     * @return The only slot the hash can be stored in.
+     */
+    Slot& slotOf(std::uint64_t key) const {
+        return slots[static_cast<std::size_t>(key) & mask];
+    }
+
+public:
+    /**
+     * @brief Constructor to create an empty table.
+     *
+     * @param minimumSlots Number of slots, rounded up to a power of two.
+     */
+    explicit TranspositionTable(std::size_t minimumSlots) : mask{0} {
+        while (mask + 1 < minimumSlots) {
+            mask = mask << 1 | 1;
+        }
+        slots = std::make_unique<Slot[]>(mask + 1);
+    }
+
+    /**
+     * @brief Getter method to retrieve the number of slots.
+     *
+     * @return The most values the table can hold.
+     */
+    std::size_t size() const {
+        return mask + 1;
+    }
+
+    /**
+     * @brief Looks up the value of a hash.
+     *
+     * @param key The hash of the state.
+     * @param value Receives the value on success.
+     * @return false if the hash is not stored or its slot is being written.
+     */
+    bool find(std::uint64_t key, Value& value) const {
+        const Slot& slot = slotOf(key);
+        std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before == 0 || (before & 1) != 0
+                || slot.key.load(std::memory_order_relaxed) != key) {
+            return false;
+        }
+        std::uint64_t words[WORDS];
+        for (std::size_t word = 0; word < WORDS; word++) {
+            words[word] = slot.words[word].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+        std::memcpy(&value, words, sizeof(Value));
+        return true;
+    }
+
+    /**
+     * @brief Stores the value of a hash, replacing the slot's old value.
+     *
+     * @details If another thread is writing the same slot, the value is
+     *          dropped.
+     *
+     * @param key The hash of the state.
+     * @param value The value to cache.
+     */
+    void store(std::uint64_t key, const Value& value) {
+        Slot& slot = slotOf(key);
+        std::uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        if ((sequence & 1) != 0 || !slot.sequence.compare_exchange_strong(
+                sequence, sequence + 1, std::memory_order_relaxed)) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::uint64_t words[WORDS] = {};
+        std::memcpy(words, &value, sizeof(Value));
+        slot.key.store(key, std::memory_order_relaxed);
+        for (std::size_t word = 0; word < WORDS; word++) {
+            slot.words[word].store(words[word], std::memory_order_relaxed);
+        }
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Forgets all values.
+     *
+     * @details Must not run while other threads use the table.
+     */
+    void clear() {
+        for (std::size_t index = 0; index <= mask; index++) {
+            slots[index].sequence.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+#endif /* TRANSPOSITIONTABLE_H_ */
@@ -0,0 +1,107 @@
+/**
+ * @file Zobrist.h
+ * @brief Header file for the Zobrist class, the random keys that hash the
+ *        state of a grid.
+ *
+ * @details The hash of a grid is the XOR of one key per (cell, code) pair
+ *          with a code other than 0 and one key per ship. A shot changes one
+ *          cell, so the grids update their hash with one or two XORs instead
+ *          of hashing the whole grid again. Equal states reached through
+ *          different shot orders have equal hashes, and the empty grid has
+ *          hash 0. The cell keys of ZOBRIST are generated by the compiler.
+ *
+ *          Hashes of grids with different rules are not comparable.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef ZOBRIST_H_
+#define ZOBRIST_H_
+
+#include "Bitboard.h"
+#include <array>
+#include <cstdint>
+
+/**
+ * @class Zobrist
+ * @brief Keys of every cell code and every ship.
+ */
+class Zobrist {
+public:
+    static constexpr int CODES = 4; ///< Codes of a cell; code 0 has no key.
+
+private:
+    /// Key of each cell and code, at index cell * CODES + code.
+    std::array<std::uint64_t, Bitboard::CAPACITY * CODES> cellKeys;
+
+public:
+    /**
+     * @brief Scrambles a number with the splitmix64 finalizer.
+     * @param value The number.
+     * @return A well mixed 64 bit value; different numbers never collide.
+     */
+    static constexpr std::uint64_t mix(std::uint64_t value) {
+        value += 0x9e3779b97f4a7c15;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * @brief Constructor to generate the cell keys.
+     */
+    constexpr Zobrist() : cellKeys{} {
+        for (int cell = 0; cell < Bitboard::CAPACITY; cell++) {
+            for (int code = 1; code < CODES; code++) {
+                cellKeys[cell * CODES + code] = mix(
+                        std::uint64_t(cell * CODES + code));
+            }
+        }
+    }
+
+    /**
+     * @brief Getter method to retrieve the key of a cell code.
+     * @param cell Linear index of the cell.
+     * @param code The code of the cell (0 to CODES - 1).
+     * @return The key; 0 for code 0.
+     */
+    constexpr std::uint64_t cellKey(int cell, int code) const {
+        return cellKeys[cell * CODES + code];
+    }
+
+    /**
+     * @brief Computes the combined key of cells that share a code.
+     * @param cells The cells.
+     * @param code The code of all of them.
+     * @return The XOR of their keys.
+     */
+    constexpr std::uint64_t cellsKey(Bitboard cells, int code) const {
+        std::uint64_t key = 0;
+        for (int cell = cells.popFirst(); cell >= 0; cell = cells.popFirst()) {
+            key ^= cellKey(cell, code);
+        }
+        return key;
+    }
+
+    /**
+     * @brief Getter method to retrieve the key of a ship.
+     * @details A straight ship is identified by the cells it covers.
+     * @param cells The cells of the ship, e.g. Ship::occupiedMask().
+     * @return The key of the ship.
+     */
+    static constexpr std::uint64_t shipKey(Bitboard cells) {
+        return mix(mix(cells.getHigh()) ^ cells.getLow());
+    }
+};
+
+/**
+ * @brief The keys used by OwnGrid and OpponentGrid, generated at compile
+ *        time.
+ */
+inline constexpr Zobrist ZOBRIST{};
+
+#endif /* ZOBRIST_H_ */
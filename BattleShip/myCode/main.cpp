@@ -29,6 +29,7 @@
 #include "part1testscpp.h"
 #include "part2testscpp.h"
 #include "part3testscpp.h"
+#include "part4testscpp.h"
 
 using namespace std;
 
@@ -37,6 +38,7 @@ int main() {
 	part1tests ();
 	part2tests ();
 	part3tests ();
+	part4tests ();
     /**
      * @brief Create an object of the Board class with 10x10 grid dimensions.
      *
@@ -72,10 +74,17 @@ int main() {
      * If all ships are successfully placed, print their occupied areas and
      * update the grid. Otherwise, print an error message.
      */
-    if (myBoard.getOwnGrid().placeShip(myShip1) &&
-        myBoard.getOwnGrid().placeShip(myShip2) &&
-        myBoard.getOwnGrid().placeShip(myShip3)) {
-
+    bool allShipsPlaced = true;
+    // Stop at the first ship that can't be placed
+    for (const Ship& ship : {myShip1, myShip2, myShip3}) {
+        PlacementResult result = myBoard.getOwnGrid().tryPlaceShip(ship);
+        cout << result << endl;
+        if (result.isValid() == false) {
+            allShipsPlaced = false;
+            break;
+        }
+    }
+    if (allShipsPlaced) {
         cout << "All 3 ships can be placed in the player grid" << endl;
         cout << "Occupied Position 1: " << myShip1.occupiedArea() << endl;
         cout << "Occupied Position 2: " << myShip2.occupiedArea() << endl;
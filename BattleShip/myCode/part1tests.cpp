@@ -17,6 +17,10 @@
 #include "part1testscpp.h"
 #include <iostream>
 #include "Board.h"
+#include "CellIndex.h"
+#include "ShotScript.h"
+#include "PlacementTable.h"
+#include <unordered_set>
 
 using namespace std;
 
@@ -71,6 +75,56 @@ void part1tests() {
     assertTrue(GridPosition{"A1"} == GridPosition{"A1"},
                "Equal Grid Position are not considered");
 
+    // Testing the packed linear index of a grid position
+    cout << "Class CellIndex: encode/decode and hash Testing" << endl<<endl;
+    assertTrue(CellIndex::fromPosition(GridPosition{"A1"}, 10).value() == 0,
+               "A1 is not encoded as cell 0");
+    assertTrue(CellIndex::fromPosition(GridPosition{"C4"}, 10).value() == 23,
+               "C4 is not encoded as cell 23");
+    assertTrue(CellIndex{99}.toPosition(10) == GridPosition{"J10"},
+               "Cell 99 is not decoded as J10");
+    assertTrue(CellIndex::fromPosition(GridPosition{"A10"}, 10)
+               < CellIndex::fromPosition(GridPosition{"B1"}, 10),
+               "Cell order does not follow the row");
+    assertTrue(GridPosition{"J10"}.isInside(10, 10)
+               && !GridPosition{"K1"}.isInside(10, 10)
+               && !GridPosition{"A11"}.isInside(10, 10),
+               "Grid bounds not detected correctly");
+    assertTrue(unordered_set<GridPosition>{GridPosition{"A1"},
+                   GridPosition{"A1"}, GridPosition{"B1"}}.size() == 2,
+               "GridPosition hash does not identify equal positions");
+
+    // Testing the non-throwing parser and the bulk coordinate loader
+    cout << "Class GridPosition: parse() and ShotScript Testing" << endl<<endl;
+    GridPosition parsedPos{'A', 1};
+    assertTrue(GridPosition::parse("J10", parsedPos) == GridPosition::OK
+               && parsedPos == GridPosition{"J10"}, "J10 is not parsed");
+    assertTrue(GridPosition::parse("", parsedPos) == GridPosition::EMPTY,
+               "Empty text is parsed");
+    assertTrue(GridPosition::parse("#1", parsedPos) == GridPosition::BAD_ROW,
+               "#1 is parsed");
+    assertTrue(GridPosition::parse("B", parsedPos) == GridPosition::BAD_COLUMN
+               && GridPosition::parse("B1x", parsedPos)
+                      == GridPosition::BAD_COLUMN
+               && GridPosition::parse("A0", parsedPos)
+                      == GridPosition::BAD_COLUMN
+               && GridPosition::parse("A00", parsedPos)
+                      == GridPosition::BAD_COLUMN
+               && parsedPos == GridPosition{"J10"},
+               "Position without valid column is parsed");
+    ShotScript script;
+    assertTrue(script.parse("A1 B2,\nJ10 # comment\nC3") == ShotScript::OK
+               && script.getPositions().size() == 4
+               && script.getPositions()[2] == GridPosition{"J10"}
+               && script.getPositions().capacity() == 4,
+               "Shot script is not parsed correctly");
+    assertTrue(script.parse("A1 B? C3") == ShotScript::SYNTAX_ERROR
+               && script.getErrorOffset() == 3
+               && script.getErrorReason() == GridPosition::BAD_COLUMN,
+               "Syntax error in shot script is not reported");
+    assertTrue(script.load("does/not/exist.txt") == ShotScript::FILE_ERROR,
+               "Missing shot script file is not reported");
+
     // Testing the working of the Ship Constructor
     cout << "Class Ship: Constructor Testing " << endl<<endl;
     assertTrue(!Ship{GridPosition{"B1"}, GridPosition{"B1"}}.isValid(),
@@ -104,4 +158,58 @@ void part1tests() {
                                      GridPosition{"B3"}, GridPosition{"C3"},
                                      GridPosition{"B2"}, GridPosition{"C2"}},
                "Blocked area not correct");
+
+    // Testing the bit masks of a ship against the set based areas
+    cout << "Class Ship: occupiedMask() and blockedMask() Testing"
+    		<< endl<<endl;
+    Ship maskShip{GridPosition{"J7"}, GridPosition{"H7"}};
+    assertTrue(maskShip.occupiedMask(STANDARD_RULES).toPositions(10)
+                   == maskShip.occupiedArea(),
+               "Occupied mask does not match occupied area");
+    assertTrue(maskShip.blockedMask(STANDARD_RULES).toPositions(10)
+                   == maskShip.blockedArea(),
+               "Blocked mask does not match blocked area");
+
+    // Testing the compile time table of all placements
+    cout << "Class PlacementTable: placement masks Testing" << endl<<endl;
+    static_assert(STANDARD_PLACEMENTS.size() == 600,
+                  "Standard board must have 600 placements");
+    int maskIndex = STANDARD_PLACEMENTS.indexOf(maskShip);
+    assertTrue(maskIndex >= 0
+               && STANDARD_PLACEMENTS[maskIndex].occupied
+                      == maskShip.occupiedMask(STANDARD_RULES)
+               && STANDARD_PLACEMENTS[maskIndex].blocked
+                      == maskShip.blockedMask(STANDARD_RULES),
+               "Placement table entry does not match the ship");
+    assertTrue(STANDARD_PLACEMENTS[maskIndex].toShip().occupiedArea()
+                   == maskShip.occupiedArea(),
+               "Placement is not converted back to the ship");
+    assertTrue(STANDARD_PLACEMENTS.indexOf(Ship{GridPosition{"A1"},
+                   GridPosition{"B2"}}) == -1,
+               "Diagonal ship has a placement");
+    // Checked on the masks alone, without creating a Ship per placement
+    bool allMasksMatch = true;
+    for (int index = 0; index < STANDARD_PLACEMENTS.size(); index++) {
+        const Placement& placement = STANDARD_PLACEMENTS[index];
+        Bitboard around;
+        Bitboard cells = placement.occupied;
+        for (int cell = cells.popFirst(); cell >= 0;
+                cell = cells.popFirst()) {
+            for (int row = cell / 10 - 1; row <= cell / 10 + 1; row++) {
+                for (int column = cell % 10 - 1; column <= cell % 10 + 1;
+                        column++) {
+                    if (row >= 0 && row < 10 && column >= 0 && column < 10) {
+                        around |= Bitboard::cell(row * 10 + column);
+                    }
+                }
+            }
+        }
+        allMasksMatch = allMasksMatch
+                && STANDARD_PLACEMENTS.indexOf(placement.rowIndex,
+                       placement.columnIndex, placement.length,
+                       placement.vertical) == index
+                && placement.occupied.count() == placement.length
+                && placement.blocked == around;
+    }
+    assertTrue(allMasksMatch, "Placement table does not match blocked areas");
 }
@@ -17,6 +17,7 @@
 #include "part2testscpp.h"
 #include <iostream>
 #include "Board.h"
+#include <stdexcept>
 
 using namespace std;
 
@@ -64,4 +65,78 @@ void part2tests() {
     assertTrue1(!playerGrid.placeShip(Ship{GridPosition{"I10"},
                                            GridPosition{"J9"}}),
                 "Ship cannot be placed");
+
+    // Testing the quiet, typed validation results of placeShip()
+    cout << "Class OwnGrid: tryPlaceShip() result Testing" << endl<<endl;
+    assertTrue1(playerGrid.tryPlaceShip(Ship{GridPosition{"A1"},
+                                             GridPosition{"A5"}}).getStatus()
+                    == PlacementResult::QUOTA_EXCEEDED,
+                "Second carrier ship is not reported as quota exceeded");
+    assertTrue1(playerGrid.tryPlaceShip(Ship{GridPosition{"K1"},
+                                             GridPosition{"K3"}}).getStatus()
+                    == PlacementResult::OUT_OF_BOUNDS,
+                "Ship outside the 10x10 grid is not reported");
+    assertTrue1(playerGrid.tryPlaceShip(Ship{GridPosition{"A1"},
+                                             GridPosition{"A7"}}).getStatus()
+                    == PlacementResult::BAD_LENGTH,
+                "Ship of length 7 is not reported as bad length");
+    assertTrue1(playerGrid.tryPlaceShip(Ship{GridPosition{"I10"},
+                                             GridPosition{"J9"}}).getStatus()
+                    == PlacementResult::NOT_STRAIGHT,
+                "Diagonal ship is not reported as not straight");
+    assertTrue1(playerGrid.tryPlaceShip(Ship{GridPosition{"H4"},
+                                             GridPosition{"H6"}}).getStatus()
+                    == PlacementResult::TOUCHING,
+                "Touching ship is not reported");
+    assertTrue1(playerGrid.tryPlaceShip(Ship{GridPosition{"A1"},
+                                             GridPosition{"C1"}}).isValid(),
+                "Free ship is not placed");
+
+    // Ship touching the first ship, not the most recently placed one
+    assertTrue1(playerGrid.tryPlaceShip(Ship{GridPosition{"J7"},
+                                             GridPosition{"J8"}}).getStatus()
+                    == PlacementResult::TOUCHING,
+                "Ship touching an earlier ship is not reported");
+
+    // Testing grids that follow other rule sets
+    cout << "Class RuleSet: house rules Testing" << endl<<endl;
+    static_assert(STANDARD_RULES.getFleetSize() == 10
+                  && STANDARD_RULES.getFleetCells() == 30,
+                  "Standard fleet must have 10 ships covering 30 cells");
+    OwnGrid hasbroGrid{RuleSet::hasbro()};
+    assertTrue1(hasbroGrid.placeShip(Ship{GridPosition{"A1"},
+                                          GridPosition{"A4"}})
+                && hasbroGrid.tryPlaceShip(Ship{GridPosition{"C1"},
+                                                GridPosition{"C4"}})
+                       .getStatus() == PlacementResult::QUOTA_EXCEEDED,
+                "Hasbro rules allow a second battleship");
+
+    RuleSet houseRules = STANDARD_RULES;
+    assertTrue1(RuleSet::parse("rows = 11\ncolumns=11 # larger board\n"
+                               "ships = 5,4,3,3,2\ntouching = true\n",
+                               houseRules) == RuleSet::OK
+                && houseRules.getRows() == 11 && houseRules.getQuota(3) == 2
+                && houseRules.mayShipsTouch(),
+                "House rules are not parsed");
+    assertTrue1(RuleSet::parse("rows = 20\ncolumns = 20\n", houseRules)
+                       == RuleSet::TOO_LARGE
+                && RuleSet::parse("rows = 27\ncolumns = 1\n", houseRules)
+                       == RuleSet::TOO_LARGE
+                && RuleSet::parse("rows: 9\n", houseRules)
+                       == RuleSet::BAD_SYNTAX
+                && houseRules.getRows() == 11,
+                "Board larger than 128 cells or 26 rows is accepted");
+    bool mixedRulesRejected = false;
+    try {
+        Board mixed{OwnGrid{RuleSet::hasbro()}, OpponentGrid{STANDARD_RULES}};
+    } catch (const invalid_argument&) {
+        mixedRulesRejected = true;
+    }
+    assertTrue1(mixedRulesRejected, "Board accepts grids of different rules");
+    OwnGrid houseGrid{houseRules};
+    assertTrue1(houseGrid.placeShip(Ship{GridPosition{"K7"},
+                                         GridPosition{"K11"}})
+                && houseGrid.placeShip(Ship{GridPosition{"J8"},
+                                            GridPosition{"J11"}}),
+                "Touching ships on the larger board can't be placed");
 }
@@ -17,6 +17,8 @@
 #include "part3testscpp.h"
 #include <iostream>
 #include "Board.h"
+#include "BoardCheckpoint.h"
+#include "SharedBoard.h"
 #include "Shot.h"
 
 using namespace std;
@@ -52,6 +54,12 @@ void part3tests() {
     assertTrue2(ownGrid.placeShip(Ship{GridPosition{"I2"}, GridPosition{"I6"}}),
                 "Ship can't be placed in the given Grid Position");
 
+    // Looking up the ship on a cell
+    assertTrue2(ownGrid.shipIdAt(GridPosition{"I4"}) == 0
+                && ownGrid.shipIdAt(GridPosition{"H4"}) == OwnGrid::NO_SHIP
+                && ownGrid.shipIdAt(GridPosition{"Z99"}) == OwnGrid::NO_SHIP,
+                "Ship lookup by cell is not correct");
+
     // Putting shot at one of ship occupied position (I5)
     Shot targetPosition1{GridPosition{"I5"}};
     Shot::Impact shotResult1 = ownGrid.takeBlow(targetPosition1);
@@ -64,6 +72,22 @@ void part3tests() {
     assertTrue2((shotResult2 == Shot::Impact::HIT) == false,
     		"Shot hit the ship");
 
+    // Hitting the remaining cells sinks the ship, repeated shots don't count
+    assertTrue2(ownGrid.takeBlow(Shot{GridPosition{"I2"}}) == Shot::Impact::HIT
+                && ownGrid.takeBlow(Shot{GridPosition{"I3"}})
+                       == Shot::Impact::HIT
+                && ownGrid.takeBlow(Shot{GridPosition{"I3"}})
+                       == Shot::Impact::HIT
+                && ownGrid.takeBlow(Shot{GridPosition{"I4"}})
+                       == Shot::Impact::HIT,
+                "Shot didn't hit the ship");
+    assertTrue2(ownGrid.takeBlow(Shot{GridPosition{"I6"}})
+                    == Shot::Impact::SUNKEN,
+                "Last shot didn't sink the ship");
+    assertTrue2(ownGrid.takeBlow(Shot{GridPosition{"I6"}})
+                    == Shot::Impact::SUNKEN,
+                "Sunken ship is not reported as sunken again");
+
     // Testing the working of the shotResult method in OpponentGrid class
     cout << "Class OpponentGrid: shotResult() method Testing" << endl << endl;
 
@@ -87,4 +111,325 @@ void part3tests() {
     assertTrue2((opponentGrid.getShots()
     		.at(GridPosition{"I8"}) == Shot::Impact::SUNKEN)==true,
                 "Shot is not marked as SUNKEN");
+    assertTrue2(opponentGrid.getSunkenShip().size() == 1
+                && opponentGrid.getSunkenShip()[0].length() == 3
+                && opponentGrid.getRemainingShips()[3] == 2,
+                "Consecutive SUNKEN reports are not merged into one ship");
+    std::uint64_t grownHash = opponentGrid.getHash();
+    assertTrue2(opponentGrid.undo()
+                && opponentGrid.getSunkenShip().size() == 1
+                && opponentGrid.getSunkenShip()[0].getBow()
+                       == GridPosition{"I8"}
+                && opponentGrid.getSunkenShip()[0].length() == 2
+                && opponentGrid.getRemainingShips()[2] == 3
+                && opponentGrid.redo()
+                && opponentGrid.getSunkenShip()[0].length() == 3
+                && opponentGrid.getHash() == grownHash,
+                "Undoing a grown ship does not restore the replaced one");
+
+    // Testing the ship inference of the shotResult method
+    cout << "Class OpponentGrid: ship inference Testing" << endl << endl;
+    OpponentGrid inferenceGrid;
+    inferenceGrid.shotResult(Shot{GridPosition{"C2"}}, Shot::Impact::HIT);
+    CellIndex diagonal = CellIndex::fromPosition(GridPosition{"D3"}, 10);
+    assertTrue2(inferenceGrid.getWaterMask().test(diagonal)
+                && inferenceGrid.getSunkenShip().empty(),
+                "Diagonal of a hit is not known to be water");
+    inferenceGrid.shotResult(Shot{GridPosition{"D2"}}, Shot::Impact::HIT);
+    inferenceGrid.shotResult(Shot{GridPosition{"E2"}}, Shot::Impact::SUNKEN);
+    CellIndex bow = CellIndex::fromPosition(GridPosition{"B2"}, 10);
+    CellIndex stern = CellIndex::fromPosition(GridPosition{"F2"}, 10);
+    assertTrue2(inferenceGrid.getSunkenShip().size() == 1
+                && inferenceGrid.getOpponentShips().size() == 1
+                && inferenceGrid.getSunkenShip()[0].length() == 3
+                && inferenceGrid.getRemainingShips()[3] == 2
+                && inferenceGrid.getShots().at(GridPosition{"C2"})
+                       == Shot::Impact::SUNKEN,
+                "Sunken ship is not resolved from its hits");
+    assertTrue2(inferenceGrid.getWaterMask().test(bow)
+                && inferenceGrid.getWaterMask().test(stern)
+                && inferenceGrid.getWaterMask().count() == 12
+                && inferenceGrid.getHitMask().count() == 3,
+                "Cells around a sunken ship are not known to be water");
+    assertTrue2(inferenceGrid.undo()
+                && inferenceGrid.getSunkenShip().empty()
+                && inferenceGrid.getRemainingShips()[3] == 3
+                && inferenceGrid.getShots().at(GridPosition{"C2"})
+                       == Shot::Impact::HIT
+                && !inferenceGrid.getWaterMask().test(bow)
+                && inferenceGrid.redo()
+                && inferenceGrid.getSunkenShip().size() == 1,
+                "Undoing a SUNKEN result does not restore the inference");
+    OpponentGrid haloGrid;
+    haloGrid.shotResult(Shot{GridPosition{"C2"}}, Shot::Impact::HIT);
+    assertTrue2(haloGrid.undo() && haloGrid.getWaterMask().none()
+                && haloGrid.getHash() == 0,
+                "Undoing a HIT result keeps its diagonals as water");
+
+    // Testing results that contradict earlier results
+    OpponentGrid correctedGrid;
+    OpponentGrid expectedGrid;
+    for (const char* hit : {"C2", "D2"}) {
+        correctedGrid.shotResult(Shot{GridPosition{hit}}, Shot::Impact::HIT);
+        expectedGrid.shotResult(Shot{GridPosition{hit}}, Shot::Impact::HIT);
+    }
+    correctedGrid.shotResult(Shot{GridPosition{"E2"}}, Shot::Impact::SUNKEN);
+    correctedGrid.shotResult(Shot{GridPosition{"E2"}}, Shot::Impact::NONE);
+    expectedGrid.shotResult(Shot{GridPosition{"E2"}}, Shot::Impact::NONE);
+    assertTrue2(correctedGrid.getSunkenShip().empty()
+                && correctedGrid.getRemainingShips()[3] == 3
+                && correctedGrid.getCellState(GridPosition{"C2"})
+                       == OpponentGrid::HIT
+                && correctedGrid.getWaterMask() == expectedGrid.getWaterMask()
+                && correctedGrid.getHash() == expectedGrid.getHash(),
+                "Corrected SUNKEN result keeps the stale ship");
+    assertTrue2(correctedGrid.undo()
+                && correctedGrid.getSunkenShip().size() == 1
+                && correctedGrid.getRemainingShips()[3] == 2,
+                "Undoing a correction does not restore the sunken ship");
+    OpponentGrid loneGrid;
+    loneGrid.shotResult(Shot{GridPosition{"F5"}}, Shot::Impact::SUNKEN);
+    assertTrue2(loneGrid.getSunkenShip().empty()
+                && loneGrid.getRemainingShips() == STANDARD_RULES.getQuotas()
+                && loneGrid.getCellState(GridPosition{"F5"})
+                       == OpponentGrid::SUNK,
+                "Lone SUNKEN cell is resolved as a ship of no quota");
+    loneGrid.shotResult(Shot{GridPosition{"F6"}}, Shot::Impact::SUNKEN);
+    assertTrue2(loneGrid.getSunkenShip().size() == 1
+                && loneGrid.getRemainingShips()[2] == 3,
+                "SUNKEN cells are not merged into a ship of the fleet");
+
+    RuleSet touchingRules{10, 10, RuleSet::Quota{0, 0, 2, 0, 0, 0}, true};
+    OpponentGrid inLineGrid{touchingRules};
+    inLineGrid.shotResult(Shot{GridPosition{"A1"}}, Shot::Impact::HIT);
+    inLineGrid.shotResult(Shot{GridPosition{"A2"}}, Shot::Impact::SUNKEN);
+    inLineGrid.shotResult(Shot{GridPosition{"A3"}}, Shot::Impact::HIT);
+    inLineGrid.shotResult(Shot{GridPosition{"A4"}}, Shot::Impact::SUNKEN);
+    assertTrue2(inLineGrid.getSunkenShip().size() == 2
+                && inLineGrid.getSunkenShip()[0].length() == 2
+                && inLineGrid.getSunkenShip()[1].length() == 2
+                && inLineGrid.getRemainingShips()[2] == 0,
+                "Ship in line with a sunken ship replaces it");
+    inLineGrid.shotResult(Shot{GridPosition{"A5"}}, Shot::Impact::HIT);
+    inLineGrid.shotResult(Shot{GridPosition{"A6"}}, Shot::Impact::SUNKEN);
+    assertTrue2(inLineGrid.getSunkenShip().size() == 2
+                && inLineGrid.getCellState(GridPosition{"A6"})
+                       == OpponentGrid::SUNK,
+                "Ship beyond the remaining fleet is resolved");
+
+    // Testing the cell states and their masks
+    inferenceGrid.shotResult(Shot{GridPosition{"J10"}}, Shot::Impact::NONE);
+    inferenceGrid.shotResult(Shot{GridPosition{"H8"}}, Shot::Impact::HIT);
+    inferenceGrid.shotResult(Shot{GridPosition{"K1"}}, Shot::Impact::HIT);
+    assertTrue2(inferenceGrid.getCellState(GridPosition{"J10"})
+                    == OpponentGrid::MISS
+                && inferenceGrid.getCellState(GridPosition{"H8"})
+                       == OpponentGrid::HIT
+                && inferenceGrid.getCellState(GridPosition{"D2"})
+                       == OpponentGrid::SUNK
+                && inferenceGrid.getCellState(GridPosition{"K1"})
+                       == OpponentGrid::UNKNOWN,
+                "Cell states do not match the reported results");
+    assertTrue2(inferenceGrid.getStateMask(OpponentGrid::MISS).count() == 1
+                && inferenceGrid.getStateMask(OpponentGrid::HIT).count() == 1
+                && inferenceGrid.getStateMask(OpponentGrid::SUNK).count() == 3
+                && inferenceGrid.getStateMask(OpponentGrid::UNKNOWN).count()
+                       == 95
+                && inferenceGrid.getShots().size() == 5,
+                "State masks do not partition the grid");
+
+    // Testing undo and redo of moves on both grids
+    cout << "Class OwnGrid/OpponentGrid: undo() and redo() Testing"
+         << endl << endl;
+    OwnGrid journalGrid;
+    journalGrid.placeShip(Ship{GridPosition{"A1"}, GridPosition{"A2"}});
+    journalGrid.takeBlow(Shot{GridPosition{"A1"}});
+    assertTrue2(journalGrid.takeBlow(Shot{GridPosition{"A2"}})
+                    == Shot::Impact::SUNKEN,
+                "Submarine is not sunken");
+    assertTrue2(journalGrid.undo()
+                && journalGrid.takeBlow(Shot{GridPosition{"A2"}})
+                       == Shot::Impact::SUNKEN,
+                "Undone shot is still counted");
+    assertTrue2(journalGrid.undo() && journalGrid.undo() && journalGrid.undo()
+                && !journalGrid.canUndo()
+                && journalGrid.getShips().empty()
+                && journalGrid.getShotMask().none()
+                && journalGrid.shipIdAt(GridPosition{"A1"})
+                       == OwnGrid::NO_SHIP,
+                "Undo does not restore the empty grid");
+    assertTrue2(journalGrid.redo() && journalGrid.redo()
+                && journalGrid.getShips().size() == 1
+                && journalGrid.takeBlow(Shot{GridPosition{"A2"}})
+                       == Shot::Impact::SUNKEN
+                && !journalGrid.canRedo(),
+                "Redo does not restore the moves");
+    assertTrue2(journalGrid.undo() && journalGrid.undo() && journalGrid.undo()
+                && journalGrid.placeShip(Ship{GridPosition{"B1"},
+                                              GridPosition{"B2"}}),
+                "Undone placement still blocks its neighbours");
+
+    OpponentGrid journalOpponent;
+    journalOpponent.shotResult(Shot{GridPosition{"C3"}}, Shot::Impact::NONE);
+    journalOpponent.shotResult(Shot{GridPosition{"C3"}}, Shot::Impact::HIT);
+    assertTrue2(journalOpponent.undo()
+                && journalOpponent.getShots().at(GridPosition{"C3"})
+                       == Shot::Impact::NONE
+                && journalOpponent.undo()
+                && journalOpponent.getShots().empty()
+                && journalOpponent.redo() && journalOpponent.redo()
+                && journalOpponent.getShots().at(GridPosition{"C3"})
+                       == Shot::Impact::HIT,
+                "Opponent grid undo/redo does not restore the results");
+
+    // Unjournaled moves change the state like journaled ones
+    OwnGrid fastGrid;
+    OwnGrid slowGrid;
+    for (OwnGrid* grid : {&fastGrid, &slowGrid}) {
+        grid->placeShip(Ship{GridPosition{"A1"}, GridPosition{"A2"}});
+        grid->clearJournal();
+    }
+    fastGrid.takeBlowUnjournaled(CellIndex{0});
+    slowGrid.takeBlow(CellIndex{0});
+    slowGrid.takeBlow(CellIndex{1});
+    OpponentGrid fastOpponent;
+    OpponentGrid slowOpponent;
+    fastOpponent.shotResultUnjournaled(CellIndex{0}, Shot::Impact::HIT);
+    fastOpponent.shotResultUnjournaled(CellIndex{1}, Shot::Impact::SUNKEN);
+    slowOpponent.shotResult(Shot{GridPosition{"A1"}}, Shot::Impact::HIT);
+    slowOpponent.shotResult(Shot{GridPosition{"A2"}}, Shot::Impact::SUNKEN);
+    assertTrue2(fastGrid.takeBlowUnjournaled(CellIndex{1})
+                    == Shot::Impact::SUNKEN
+                && !fastGrid.canUndo() && !fastOpponent.canUndo()
+                && fastGrid.getHash() == slowGrid.getHash()
+                && fastOpponent.getHash() == slowOpponent.getHash()
+                && fastOpponent.getSunkenShip().size() == 1
+                && fastOpponent.getWaterMask() == slowOpponent.getWaterMask(),
+                "Unjournaled moves differ from journaled ones");
+
+    // Testing copy-on-write snapshots of a board
+    cout << "Class SharedBoard: fork() and with...() Testing"
+         << endl << endl;
+    SharedBoard root;
+    PlacementResult placed{PlacementResult::VALID, 0};
+    SharedBoard withShip = root.withPlacedShip(
+        Ship{GridPosition{"B2"}, GridPosition{"B3"}}, placed);
+    assertTrue2(placed.isValid() && root.getShips().empty()
+                && withShip.getShips().size() == 1
+                && &withShip.getSunkenShip() == &root.getSunkenShip(),
+                "Placing a ship changes the root or copies both grids");
+    SharedBoard rejected = withShip.withPlacedShip(
+        Ship{GridPosition{"C2"}, GridPosition{"C3"}}, placed);
+    assertTrue2(placed.getStatus() == PlacementResult::TOUCHING
+                && rejected.sharesStateWith(withShip),
+                "Rejected ship does not keep the shared state");
+    assertTrue2(withShip.fork().sharesStateWith(withShip),
+                "Fork does not share the grids");
+
+    Shot::Impact impact = Shot::Impact::NONE;
+    SharedBoard hitOnce = withShip.withBlow(Shot{GridPosition{"B2"}}, impact);
+    SharedBoard sunk = hitOnce.withBlow(Shot{GridPosition{"B3"}}, impact);
+    assertTrue2(impact == Shot::Impact::SUNKEN
+                && hitOnce.getShotMask().count() == 1
+                && withShip.getShotMask().none()
+                && sunk.sharesFleetsWith(withShip),
+                "Blows on a snapshot leak into its parent or copy a grid");
+    SharedBoard reported = sunk.withShotResult(Shot{GridPosition{"E5"}},
+                                               Shot::Impact::HIT);
+    Board materialized = reported.toBoard();
+    assertTrue2(sunk.getStateMask(OpponentGrid::HIT).none()
+                && reported.sharesFleetsWith(sunk)
+                && materialized.getOpponentGrid().getShots()
+                       .at(GridPosition{"E5"}) == Shot::Impact::HIT
+                && materialized.getOwnGrid().getShips().size() == 1,
+                "Shot results are not kept in the new snapshot only");
+
+    SharedBoard resolved = reported.withShotResult(Shot{GridPosition{"E6"}},
+                                                   Shot::Impact::SUNKEN);
+    Board mirror{STANDARD_RULES};
+    mirror.getOwnGrid().placeShip(Ship{GridPosition{"B2"},
+                                       GridPosition{"B3"}});
+    mirror.getOwnGrid().takeBlow(Shot{GridPosition{"B2"}});
+    mirror.getOwnGrid().takeBlow(Shot{GridPosition{"B3"}});
+    mirror.getOpponentGrid().shotResult(Shot{GridPosition{"E5"}},
+                                        Shot::Impact::HIT);
+    mirror.getOpponentGrid().shotResult(Shot{GridPosition{"E6"}},
+                                        Shot::Impact::SUNKEN);
+    Board replayed = resolved.toBoard();
+    assertTrue2(resolved.getSunkenShip().size() == 1
+                && reported.getSunkenShip().empty()
+                && &resolved.getShips() == &reported.getShips()
+                && replayed.getOwnGrid().getHash()
+                       == mirror.getOwnGrid().getHash()
+                && replayed.getOpponentGrid().getHash()
+                       == mirror.getOpponentGrid().getHash()
+                && replayed.getOpponentGrid().getWaterMask()
+                       == mirror.getOpponentGrid().getWaterMask(),
+                "Snapshots differ from a board with the same moves");
+
+    // Testing binary checkpoints of a board
+    cout << "Class BoardCheckpoint: restore() and toText() Testing"
+         << endl << endl;
+    Board saved{RuleSet::hasbro()};
+    saved.getOwnGrid().placeShip(Ship{GridPosition{"A1"}, GridPosition{"A5"}});
+    saved.getOwnGrid().placeShip(Ship{GridPosition{"C3"}, GridPosition{"D3"}});
+    saved.getOwnGrid().takeBlow(Shot{GridPosition{"C3"}});
+    saved.getOwnGrid().takeBlow(Shot{GridPosition{"D3"}});
+    saved.getOwnGrid().takeBlow(Shot{GridPosition{"J10"}});
+    saved.getOpponentGrid().shotResult(Shot{GridPosition{"E5"}},
+                                       Shot::Impact::HIT);
+    saved.getOpponentGrid().shotResult(Shot{GridPosition{"E6"}},
+                                       Shot::Impact::SUNKEN);
+    saved.getOpponentGrid().shotResult(Shot{GridPosition{"H2"}},
+                                       Shot::Impact::NONE);
+    saved.getOpponentGrid().shotResult(Shot{GridPosition{"B9"}},
+                                       Shot::Impact::HIT);
+    BoardCheckpoint checkpoint{saved};
+    assertTrue2(checkpoint.getBytes().size() == BoardCheckpoint::SIZE
+                && checkpoint.getRules() == RuleSet::hasbro(),
+                "Checkpoint does not keep the rules");
+
+    Board restored{STANDARD_RULES};
+    assertTrue2(checkpoint.restore(restored)
+                && restored.getOwnGrid().getRules() == RuleSet::hasbro()
+                && restored.getOwnGrid().getShips().size() == 2
+                && restored.getOwnGrid().getShotMask()
+                       == saved.getOwnGrid().getShotMask()
+                && restored.getOpponentGrid().getShots()
+                       == saved.getOpponentGrid().getShots()
+                && restored.getOpponentGrid().getSunkenShip().size() == 1
+                && restored.getOpponentGrid().getRemainingShips()
+                       == saved.getOpponentGrid().getRemainingShips()
+                && restored.getOpponentGrid().getWaterMask()
+                       == saved.getOpponentGrid().getWaterMask(),
+                "Restored board differs from the saved one");
+    assertTrue2(restored.getOwnGrid().takeBlow(Shot{GridPosition{"C3"}})
+                       == Shot::Impact::SUNKEN
+                && restored.getOwnGrid().takeBlow(Shot{GridPosition{"A1"}})
+                       == Shot::Impact::HIT
+                && !restored.getOwnGrid().placeShip(
+                       Ship{GridPosition{"B1"}, GridPosition{"B2"}})
+                && restored.getOwnGrid().placeShip(
+                       Ship{GridPosition{"G1"}, GridPosition{"G4"}}),
+                "Restored own grid does not play on");
+
+    array<unsigned char, BoardCheckpoint::SIZE> damaged
+        = checkpoint.getBytes();
+    damaged[0] = BoardCheckpoint::VERSION + 1;
+    Board untouched{STANDARD_RULES};
+    assertTrue2(!BoardCheckpoint{damaged}.restore(untouched)
+                && untouched.getOwnGrid().getRules() == STANDARD_RULES,
+                "Checkpoint of another version is restored");
+    damaged = checkpoint.getBytes();
+    damaged[BoardCheckpoint::HEADER_SIZE] ^= 0x80;
+    assertTrue2(!BoardCheckpoint{damaged}.restore(untouched)
+                && untouched.getOwnGrid().getShips().empty(),
+                "Ships that differ from the occupied cells are restored");
+
+    string text = checkpoint.toText();
+    assertTrue2(text.find('X') != string::npos
+                && text.find('S') != string::npos
+                && BoardCheckpoint{}.toBoard().getOwnGrid().getShips()
+                       .empty(),
+                "Checkpoint text does not show hits and sunken ships");
 }
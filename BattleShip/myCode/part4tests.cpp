@@ -0,0 +1,953 @@
+/**
+ * @file part4tests.cpp
+ * @brief Test file for the simulation classes.
+ *
+ * @details This file contains tests for the Random generator and the
+ *          FleetGenerator: deterministic seeding, legality of the generated
+ *          fleets and the uniformity of the uniform policies. Layout
+ *          counts of the FleetEnumerator are compared with a brute force
+ *          search on small boards. Complete games are played with the
+ *          MatchEngine, the built-in strategies and the Tournament, and
+ *          recorded in replay files. The EndgameSolver is checked against
+ *          hand-computed optimal policies.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#include "part4testscpp.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <utility>
+#include "BoardCheckpoint.h"
+#include "EndgameSolver.h"
+#include "FleetEnumerator.h"
+#include "FleetGenerator.h"
+#include "FleetSampler.h"
+#include "HeatMap.h"
+#include "HeatMapStrategy.h"
+#include "HuntTargetStrategy.h"
+#include "MatchEngine.h"
+#include "Random.h"
+#include "RandomStrategy.h"
+#include "ReplayReader.h"
+#include "ReplayWriter.h"
+#include "Tournament.h"
+#include "TranspositionTable.h"
+
+using namespace std;
+
+/**
+ * @brief Helper function to assert if a condition is true and print an error
+ *        message if it fails.
+ *
+ * @param condition The condition to test.
+ * @param failedMessage The message to display if the condition is false.
+ */
+void assertTrue3(bool condition, string failedMessage) {
+    if (!condition) {
+        cout << "Error: " << failedMessage << endl;
+    }
+}
+
+/**
+ * @struct StubbornStrategy
+ * @brief Test strategy that always shoots at A1 and counts the results it
+ *        observes.
+ */
+struct StubbornStrategy {
+    FleetGenerator fleets; ///< Places the own fleet.
+    Random& random;        ///< Source of the placements.
+    int observed = 0;      ///< Results observed.
+    int hits = 0;          ///< Observed results that hit a ship.
+
+    /// Constructor to create a strategy that places with random.
+    explicit StubbornStrategy(Random& random)
+        : fleets{STANDARD_RULES, FleetGenerator::AVOID_EDGES},
+          random{random} {
+    }
+
+    /// Places the whole fleet on an empty grid.
+    bool placeFleet(OwnGrid& grid) {
+        return fleets.fill(grid, random);
+    }
+
+    /// Always chooses A1.
+    CellIndex nextShot(const OpponentGrid&) {
+        return CellIndex{0};
+    }
+
+    /// Counts the result.
+    void observe(CellIndex, Shot::Impact impact) {
+        observed++;
+        hits += impact != Shot::Impact::NONE;
+    }
+};
+
+/**
+ * @brief Counts layouts by trying every set of placements, as a reference
+ *        for FleetEnumerator.
+ *
+ * @param table The placements of the rules.
+ * @param quota Ships of each length still to place.
+ * @param knowledge The shot record the layout has to match.
+ * @param index The next placement to decide on.
+ * @param blocked Blocked cells of the chosen placements.
+ * @param occupied Cells of the chosen placements.
+ * @return The number of layouts.
+ */
+static long bruteForceCount(const PlacementTable& table, RuleSet::Quota quota,
+        const ShotKnowledge& knowledge, int index, Bitboard blocked,
+        Bitboard occupied) {
+    if (index == table.size()) {
+        bool complete = all_of(quota.begin(), quota.end(),
+                [](int ships) { return ships == 0; });
+        return complete && knowledge.covers(occupied) ? 1 : 0;
+    }
+    const Placement& placement = table[index];
+    long total = bruteForceCount(table, quota, knowledge, index + 1, blocked,
+            occupied);
+    if (quota[placement.length] > 0 && knowledge.allows(placement)
+            && !placement.occupied.intersects(blocked)) {
+        quota[placement.length]--;
+        total += bruteForceCount(table, quota, knowledge, index + 1,
+                blocked | placement.blocked, occupied | placement.occupied);
+    }
+    return total;
+}
+
+/**
+ * @brief Test function for the simulation classes Random, FleetGenerator,
+ *        ThreadPool, FleetEnumerator, HeatMap and FleetSampler.
+ */
+void part4tests() {
+    // Testing the random number generator
+    cout << "Class Random: seeding and ranges Testing" << endl << endl;
+    Random first{42};
+    Random second{42};
+    Random other{43};
+    bool sameSequence = true;
+    bool inRange = true;
+    for (int draw = 0; draw < 1000; draw++) {
+        sameSequence = sameSequence && first.next() == second.next();
+        inRange = inRange && first.below(7) < 7 && first.uniform() < 1.0;
+        second.below(7);
+        second.uniform();
+    }
+    assertTrue3(sameSequence, "Equal seeds give different sequences");
+    assertTrue3(inRange, "Random value out of range");
+    assertTrue3(Random{42}.next() != other.next(),
+                "Different seeds give the same sequence");
+    Random stream = Random::stream(42, 7, Random::SAMPLING);
+    Random reseeded{Random::streamSeed(42, 7, Random::SAMPLING)};
+    assertTrue3(stream.next() == reseeded.next()
+                && stream.next() == reseeded.next(),
+                "Stream differs from its seed");
+    vector<uint64_t> firstDraws;
+    for (uint64_t game = 0; game < 1000; game++) {
+        for (uint64_t purpose : {Random::FIRST_PLAYER, Random::SECOND_PLAYER}) {
+            firstDraws.push_back(Random::stream(42, game, purpose).next());
+            firstDraws.push_back(Random::stream(43, game, purpose).next());
+        }
+    }
+    sort(firstDraws.begin(), firstDraws.end());
+    assertTrue3(adjacent_find(firstDraws.begin(), firstDraws.end())
+                    == firstDraws.end(),
+                "Streams of different games or purposes coincide");
+
+    // Testing complete fleets of every policy
+    cout << "Class FleetGenerator: generate() and fill() Testing"
+         << endl << endl;
+    for (FleetGenerator::Policy policy : {FleetGenerator::SEQUENTIAL,
+            FleetGenerator::UNIFORM, FleetGenerator::AVOID_EDGES,
+            FleetGenerator::CLUSTERED}) {
+        FleetGenerator generator{STANDARD_RULES, policy};
+        Random random{7};
+        for (int game = 0; game < 20; game++) {
+            OwnGrid grid;
+            assertTrue3(generator.fill(grid, random)
+                        && grid.getShips().size() == 10,
+                        "Generated fleet is not complete or not legal");
+        }
+    }
+    FleetGenerator hasbroFleet{RuleSet::hasbro()};
+    Random hasbroRandom{7};
+    OwnGrid hasbroGrid{RuleSet::hasbro()};
+    OwnGrid standardGrid;
+    assertTrue3(hasbroFleet.fill(hasbroGrid, hasbroRandom)
+                && hasbroGrid.getShips().size() == 5
+                && !hasbroFleet.fill(hasbroGrid, hasbroRandom)
+                && !hasbroFleet.fill(standardGrid, hasbroRandom),
+                "fill() accepts a used grid or other rules");
+
+    // Fleets of the stateless policies only depend on the Random they are
+    // drawn from
+    for (FleetGenerator::Policy policy : {FleetGenerator::SEQUENTIAL,
+            FleetGenerator::UNIFORM}) {
+        FleetGenerator reused{RuleSet::hasbro(), policy};
+        FleetGenerator::Layout redrawn;
+        FleetGenerator::Layout fresh;
+        Random redrawRandom{42};
+        reused.generate(redrawRandom, redrawn);
+        redrawRandom.seed(42);
+        reused.generate(redrawRandom, redrawn);
+        Random freshRandom{42};
+        FleetGenerator{RuleSet::hasbro(), policy}.generate(freshRandom,
+                                                           fresh);
+        assertTrue3(!fresh.empty() && redrawn == fresh,
+                    "Reseeding does not reproduce a fleet");
+    }
+
+    FleetGenerator crowded{RuleSet{3, 3, RuleSet::Quota{0, 0, 3, 0, 0, 0},
+                                   false}};
+    crowded.setMaxAttempts(1000);
+    FleetGenerator::Layout layout;
+    assertTrue3(!crowded.generate(hasbroRandom, layout),
+                "A fleet that does not fit was generated");
+
+    FleetGenerator horizontal{STANDARD_RULES,
+        [](const Placement& placement) {
+            return placement.vertical ? 0.0 : 1.0;
+        }};
+    bool allHorizontal = horizontal.generate(hasbroRandom, layout);
+    for (int index : layout) {
+        allHorizontal = allHorizontal
+                && !horizontal.getTable()[index].vertical;
+    }
+    assertTrue3(allHorizontal, "Placements of weight 0 were drawn");
+
+    // Both uniform policies draw every layout of two submarines on a 4x4
+    // board equally often
+    RuleSet small{4, 4, RuleSet::Quota{0, 0, 2, 0, 0, 0}, false};
+    for (FleetGenerator::Policy policy : {FleetGenerator::UNIFORM,
+            FleetGenerator::UNIFORM_CHAIN}) {
+        FleetGenerator generator{small, policy};
+        const PlacementTable& table = generator.getTable();
+        map<pair<int, int>, int> counts;
+        for (int first = table.begin(2); first < table.end(2); first++) {
+            for (int second = first + 1; second < table.end(2); second++) {
+                if (!table[first].blocked.intersects(table[second].occupied)) {
+                    counts[{first, second}] = 0;
+                }
+            }
+        }
+        Random random{2026};
+        const int samples = 60000;
+        bool legal = true;
+        for (int sample = 0; sample < samples; sample++) {
+            generator.generate(random, layout);
+            auto found = counts.find({min(layout[0], layout[1]),
+                                      max(layout[0], layout[1])});
+            legal = legal && found != counts.end();
+            if (found != counts.end()) {
+                found->second++;
+            }
+        }
+        double expected = double(samples) / counts.size();
+        bool uniform = true;
+        for (const auto& entry : counts) {
+            uniform = uniform && entry.second > 0.75 * expected
+                    && entry.second < 1.25 * expected;
+        }
+        assertTrue3(legal && uniform, "Uniform policy is not uniform");
+    }
+
+    // Testing exhaustive layout counts against brute force
+    cout << "Class FleetEnumerator: count() and enumerate() Testing"
+         << endl << endl;
+    ThreadPool pool{3};
+    vector<atomic<int>> runs(5000);
+    pool.run(runs.size(), [&](size_t task, unsigned) {
+        // Uneven tasks make the workers steal
+        volatile long spin = 0;
+        for (size_t step = 0; step < (task < 100 ? 20000u : 10u); step++) {
+            spin = spin + 1;
+        }
+        runs[task]++;
+    });
+    assertTrue3(all_of(runs.begin(), runs.end(), [](const atomic<int>& run) {
+                    return run == 1;
+                }),
+                "Thread pool does not run every task exactly once");
+    for (const RuleSet& rules : {
+            RuleSet{5, 5, RuleSet::Quota{0, 0, 2, 1, 0, 0}, false},
+            RuleSet{4, 6, RuleSet::Quota{0, 0, 2, 1, 0, 0}, false},
+            RuleSet{4, 4, RuleSet::Quota{0, 0, 1, 1, 0, 0}, true},
+            RuleSet{5, 5, RuleSet::Quota{0, 0, 3, 0, 0, 0}, false}}) {
+        FleetEnumerator enumerator{rules};
+        long expected = bruteForceCount(enumerator.getTable(),
+                rules.getQuotas(), ShotKnowledge{}, 0, Bitboard{},
+                Bitboard{});
+        atomic<long> visited{0};
+        enumerator.enumerate(pool, [&](const FleetEnumerator::Layout&,
+                unsigned) {
+            visited++;
+        });
+        assertTrue3(expected > 0 && enumerator.count() == uint64_t(expected)
+                    && enumerator.count(pool) == uint64_t(expected)
+                    && visited == expected,
+                    "Layout count differs from brute force");
+    }
+
+    // Only layouts that match the shots are counted
+    RuleSet fiveByFive{5, 5, RuleSet::Quota{0, 0, 2, 1, 0, 0}, false};
+    OpponentGrid record{fiveByFive};
+    record.shotResult(Shot{GridPosition{"C3"}}, Shot::Impact::NONE);
+    record.shotResult(Shot{GridPosition{"A1"}}, Shot::Impact::HIT);
+    record.shotResult(Shot{GridPosition{"A2"}}, Shot::Impact::SUNKEN);
+    record.shotResult(Shot{GridPosition{"E4"}}, Shot::Impact::HIT);
+    ShotKnowledge knowledge{record};
+    FleetEnumerator constrained{fiveByFive};
+    constrained.setKnowledge(knowledge);
+    long expected = bruteForceCount(constrained.getTable(),
+            fiveByFive.getQuotas(), knowledge, 0, Bitboard{}, Bitboard{});
+    bool matching = true;
+    constrained.enumerate([&](const FleetEnumerator::Layout& layout,
+            unsigned) {
+        Bitboard occupied;
+        for (int index : layout) {
+            matching = matching
+                    && constrained.getTable()[index].occupied.isSubsetOf(
+                            ~knowledge.getMisses());
+            occupied |= constrained.getTable()[index].occupied;
+        }
+        matching = matching && knowledge.covers(occupied);
+    });
+    assertTrue3(expected > 0 && constrained.count(pool) == uint64_t(expected)
+                && matching,
+                "Count with shot knowledge differs from brute force");
+
+    // Testing the targeting heat map
+    cout << "Class HeatMap: compute() and bestTarget() Testing"
+         << endl << endl;
+    HeatMap heatMap;
+    heatMap.compute(OpponentGrid{});
+    assertTrue3(heatMap.at(GridPosition{"A1"})
+                       == heatMap.at(GridPosition{"J10"})
+                && heatMap.at(GridPosition{"A1"})
+                       == heatMap.at(GridPosition{"A10"})
+                && heatMap.at(GridPosition{"E5"})
+                       > heatMap.at(GridPosition{"A1"})
+                && heatMap.at(GridPosition{"K1"}) == 0,
+                "Heat map of an empty grid is not symmetric");
+
+    OpponentGrid targetGrid;
+    targetGrid.shotResult(Shot{GridPosition{"E5"}}, Shot::Impact::HIT);
+    targetGrid.shotResult(Shot{GridPosition{"E6"}}, Shot::Impact::NONE);
+    targetGrid.shotResult(Shot{GridPosition{"B2"}}, Shot::Impact::SUNKEN);
+    targetGrid.shotResult(Shot{GridPosition{"H8"}}, Shot::Impact::NONE);
+    heatMap.setHitWeight(HeatMapStrategy::HIT_WEIGHT);
+    heatMap.compute(targetGrid);
+    GridPosition target = heatMap.bestTarget();
+    assertTrue3(target == GridPosition{"D5"} || target == GridPosition{"F5"}
+                || target == GridPosition{"E4"},
+                "Best target is not next to the open hit");
+
+    // Every kernel matches a direct count over the placement table
+    ShotKnowledge targetKnowledge{targetGrid};
+    const PlacementTable& table = STANDARD_PLACEMENTS;
+    array<uint32_t, Bitboard::CAPACITY> expectedHeat{};
+    array<HeatMap::Counts, Ship::MAX_LENGTH + 1> expectedLengths{};
+    for (int index = 0; index < table.size(); index++) {
+        const Placement& placement = table[index];
+        if (!placement.occupied.intersects(targetKnowledge.getMisses()
+                | targetKnowledge.getSunk())
+                && !placement.occupied.isSubsetOf(targetKnowledge.getHits())) {
+            Bitboard covered = placement.occupied;
+            for (int cell = covered.popFirst(); cell >= 0;
+                    cell = covered.popFirst()) {
+                expectedHeat[cell] += STANDARD_RULES.getQuota(placement.length);
+                expectedLengths[placement.length][cell]++;
+            }
+        }
+    }
+    for (HeatMap::Kernel kernel : {HeatMap::SCALAR, HeatMap::AVX2}) {
+        heatMap.setKernel(kernel);
+        heatMap.setHitWeight(0);
+        heatMap.compute(targetKnowledge, STANDARD_RULES.getQuotas());
+        bool lengthsMatch = true;
+        for (int length = Ship::MIN_LENGTH; length <= Ship::MAX_LENGTH;
+                length++) {
+            lengthsMatch = lengthsMatch
+                    && heatMap.getLengthCounts(length)
+                           == expectedLengths[length];
+        }
+        assertTrue3(heatMap.getCounts() == expectedHeat && lengthsMatch,
+                    "Heat map kernel differs from the direct count");
+    }
+
+    // Testing the Monte Carlo estimate against the exact occupancy
+    cout << "Class FleetSampler: sample() Testing" << endl << endl;
+    array<double, Bitboard::CAPACITY> exactOccupancy{};
+    long layouts = 0;
+    constrained.enumerate([&](const FleetEnumerator::Layout& layout,
+            unsigned) {
+        layouts++;
+        for (int index : layout) {
+            Bitboard covered = constrained.getTable()[index].occupied;
+            for (int cell = covered.popFirst(); cell >= 0;
+                    cell = covered.popFirst()) {
+                exactOccupancy[cell]++;
+            }
+        }
+    });
+    FleetSampler sampler{fiveByFive};
+    SamplerBudget budget;
+    budget.maxSamples = 50000;
+    SampleEstimate estimate = sampler.sample(record, budget, pool, 1);
+    bool close = estimate.samples == 50000 && estimate.validSamples > 0;
+    for (int cell = 0; cell < fiveByFive.getCells(); cell++) {
+        close = close && fabs(estimate.occupancy[cell]
+                - exactOccupancy[cell] / layouts)
+                <= 5 * estimate.standardError[cell] + 0.005;
+    }
+    assertTrue3(close, "Sampled occupancy differs from the exact one");
+
+    ThreadPool single{1};
+    budget.maxSamples = 10000;
+    assertTrue3(sampler.sample(record, budget, single, 9).occupancy
+                    == sampler.sample(record, budget, pool, 9).occupancy,
+                "Sample depends on the number of threads");
+
+    budget.maxSamples = 1000000;
+    budget.targetError = 0.02;
+    estimate = sampler.sample(record, budget, pool, 3);
+    assertTrue3(estimate.converged && estimate.samples < budget.maxSamples
+                && estimate.maxStandardError <= 0.02,
+                "Sampling does not stop at the target error");
+
+    // Testing complete games between two scanning players
+    cout << "Class MatchEngine: play() Testing" << endl << endl;
+    MatchEngine engine;
+    FleetGenerator matchFleets;
+    Random matchRandom{11};
+    MatchPlayer scanner;
+    scanner.placeFleet = [&](OwnGrid& grid) {
+        return matchFleets.fill(grid, matchRandom);
+    };
+    scanner.nextShot = [](const OpponentGrid& grid) {
+        Bitboard open = grid.getStateMask(OpponentGrid::UNKNOWN)
+                & ~grid.getWaterMask();
+        return CellIndex{static_cast<uint16_t>(open.first())}
+                .toPosition(grid.getColumns());
+    };
+    MatchResult match = engine.play(scanner, scanner);
+    int loser = 1 - match.winner;
+    assertTrue3(match.ending == MatchResult::ALL_SUNK
+                && (match.winner == 0 || match.winner == 1)
+                && match.sunk[match.winner] == 10
+                && match.hits[match.winner] == 30
+                && match.turns == match.shots[0] + match.shots[1]
+                && match.shots[0] - match.shots[1] == 1 - match.winner
+                && engine.getOwnGrid(loser).allShipsSunk()
+                && !engine.getOwnGrid(match.winner).allShipsSunk()
+                && engine.getOpponentGrid(match.winner).getRemainingShips()
+                       == RuleSet::Quota{},
+                "Game does not end when the last ship is sunk");
+    MatchResult again = engine.play(scanner, scanner);
+    assertTrue3(again.ending == MatchResult::ALL_SUNK
+                && engine.getOwnGrid(0).getShips().size() == 10
+                && engine.getOpponentGrid(0).getShots().size()
+                       == static_cast<size_t>(again.shots[0]),
+                "Engine does not reset the grids between games");
+
+    MatchPlayer stubborn = scanner;
+    stubborn.nextShot = [](const OpponentGrid&) {
+        return GridPosition{"A1"};
+    };
+    engine.setMaxShots(40);
+    match = engine.play(stubborn, stubborn);
+    assertTrue3(match.ending == MatchResult::SHOT_LIMIT
+                && match.winner == MatchResult::NO_WINNER
+                && match.shots[0] == 40 && match.shots[1] == 40,
+                "Shot limit does not end the game");
+    MatchPlayer lazy = scanner;
+    lazy.placeFleet = [](OwnGrid&) {
+        return true;
+    };
+    match = engine.play(lazy, scanner);
+    assertTrue3(match.ending == MatchResult::INVALID_FLEET
+                && match.winner == 1 && match.turns == 0,
+                "Incomplete fleet does not lose the game");
+
+    // Testing the strategy interface and the built-in strategies
+    cout << "Strategies: play() Testing" << endl << endl;
+    assertTrue3(isStrategy<RandomStrategy>::value
+                && isStrategy<HuntTargetStrategy>::value
+                && isStrategy<HeatMapStrategy>::value
+                && isStrategy<AnyStrategy>::value
+                && !isStrategy<MatchPlayer>::value && !isStrategy<int>::value,
+                "isStrategy does not detect the strategy hooks");
+    Random strategyRandom{21};
+    HuntTargetStrategy hunter{strategyRandom};
+    HeatMapStrategy heatSeeker{strategyRandom};
+    engine.setMaxShots(MatchEngine::DEFAULT_MAX_SHOTS);
+    match = engine.play(hunter, heatSeeker);
+    assertTrue3(match.ending == MatchResult::ALL_SUNK
+                && match.shots[match.winner] < 100
+                && engine.getOpponentGrid(match.winner).getRemainingShips()
+                       == RuleSet::Quota{},
+                "Built-in strategies do not finish a game");
+    StubbornStrategy firstStubborn{strategyRandom};
+    StubbornStrategy secondStubborn{strategyRandom};
+    engine.setMaxShots(40);
+    match = engine.play(firstStubborn, secondStubborn);
+    assertTrue3(match.ending == MatchResult::SHOT_LIMIT
+                && firstStubborn.observed == 40
+                && secondStubborn.observed == 40
+                && firstStubborn.hits == match.hits[0]
+                && secondStubborn.hits == match.hits[1],
+                "Strategy does not observe the results of its shots");
+    vector<AnyStrategy> chosen;
+    chosen.push_back(RandomStrategy{strategyRandom});
+    chosen.push_back(HuntTargetStrategy{strategyRandom});
+    engine.setMaxShots(MatchEngine::DEFAULT_MAX_SHOTS);
+    match = engine.play(chosen[0], chosen[1]);
+    assertTrue3(match.ending == MatchResult::ALL_SUNK
+                && match.sunk[match.winner] == 10,
+                "AnyStrategy does not play through the engine");
+
+    // Testing tournaments between strategies
+    cout << "Class Tournament: run() Testing" << endl << endl;
+    Tournament tournament;
+    tournament.addEntrant("random", [](Random& random) {
+        return RandomStrategy{random};
+    });
+    tournament.addEntrant("hunter", [](Random& random) {
+        return HuntTargetStrategy{random};
+    });
+    tournament.addEntrant("stubborn", [](Random& random) {
+        return StubbornStrategy{random};
+    });
+    tournament.setGamesPerPairing(100);
+    TournamentResult serial = tournament.run(single, 5);
+    TournamentResult parallel = tournament.run(pool, 5);
+    long decided = 0;
+    long drawn = 0;
+    for (const EntrantStats& stats : serial.entrants) {
+        decided += stats.wins;
+        drawn += stats.draws;
+    }
+    assertTrue3(tournament.getMatchCount() == 300 && serial.games == 300
+                && decided + drawn / 2 == 300
+                && serial.entrants[2].wins == 0
+                && serial.entrants[0].games == 200
+                && serial.pairWins[0 * 3 + 2] == 100
+                && serial.pairWins[1 * 3 + 0] > serial.pairWins[0 * 3 + 1],
+                "Round robin does not play every pairing");
+    bool equal = true;
+    for (size_t entrant = 0; entrant < 3; entrant++) {
+        equal = equal && serial.entrants[entrant].shotsToWin
+                == parallel.entrants[entrant].shotsToWin;
+    }
+    assertTrue3(equal && serial.pairWins == parallel.pairWins
+                && serial.entrants[1].meanShotsToWin > 0,
+                "Tournament results depend on the number of threads");
+    long replayedWins[2] = {0, 0};
+    for (long match = 0; match < 100; match++) {
+        MatchResult replayed = tournament.playMatch(match, 5);
+        if (replayed.winner != MatchResult::NO_WINNER) {
+            // Entrant 0 shoots first in even matches
+            replayedWins[(replayed.winner + match) % 2]++;
+        }
+    }
+    GameRecord firstReplay;
+    GameRecord secondReplay;
+    tournament.playMatch(123, 5, &firstReplay);
+    tournament.playMatch(123, 5, &secondReplay);
+    assertTrue3(replayedWins[0] == serial.pairWins[0 * 3 + 1]
+                && replayedWins[1] == serial.pairWins[1 * 3 + 0]
+                && !firstReplay.moves.empty()
+                && std::equal(firstReplay.moves.begin(),
+                        firstReplay.moves.end(),
+                        secondReplay.moves.begin(), secondReplay.moves.end(),
+                        [](const GameRecord::Move& first,
+                                const GameRecord::Move& second) {
+                            return first.target == second.target
+                                    && first.impact == second.impact;
+                        }),
+                "Replayed matches differ from the tournament run");
+    Tournament gauntlet{STANDARD_RULES, Tournament::GAUNTLET};
+    for (const char* name : {"a", "b", "c", "d"}) {
+        gauntlet.addEntrant(name, [](Random& random) {
+            return RandomStrategy{random};
+        });
+    }
+    gauntlet.setGamesPerPairing(10);
+    assertTrue3(gauntlet.getMatchCount() == 30
+                && gauntlet.run(pool).entrants[3].games == 10,
+                "Gauntlet does not pit the first entrant against the others");
+
+    // Strategies with a Markov chain placement are reset before each match
+    Tournament chained;
+    for (const char* name : {"first", "second"}) {
+        chained.addEntrant(name, [](Random& random) {
+            return HuntTargetStrategy{random, STANDARD_RULES,
+                                      FleetGenerator::UNIFORM_CHAIN};
+        });
+    }
+    chained.setGamesPerPairing(40);
+    TournamentResult chainedSerial = chained.run(single, 9);
+    long chainedWins[2] = {0, 0};
+    for (long match = 0; match < 40; match++) {
+        MatchResult replayed = chained.playMatch(match, 9);
+        if (replayed.winner != MatchResult::NO_WINNER) {
+            chainedWins[(replayed.winner + match) % 2]++;
+        }
+    }
+    assertTrue3(chainedSerial.pairWins == chained.run(pool, 9).pairWins
+                && chainedWins[0] == chainedSerial.pairWins[0 * 2 + 1]
+                && chainedWins[1] == chainedSerial.pairWins[1 * 2 + 0],
+                "Strategy state carries over from one match to the next");
+
+    // Testing the replay format with recorded games
+    cout << "Classes ReplayWriter and ReplayReader: Testing" << endl << endl;
+    vector<GameRecord> recorded(3);
+    string replay = ReplayWriter::MAGIC;
+    ReplayWriter writer;
+    for (size_t game = 0; game < recorded.size(); game++) {
+        engine.setRecord(&recorded[game]);
+        engine.play(chosen[game % 2], chosen[1 - game % 2]);
+        writer.encode(recorded[game], replay);
+    }
+
+    // Repeated and off-grid shots take the escape of the target encoding
+    GameRecord unusual;
+    unusual.rows = 10;
+    unusual.columns = 10;
+    unusual.fleets[0] = {Ship{GridPosition{"A1"}, GridPosition{"A2"}}};
+    unusual.fleets[1] = {Ship{GridPosition{"C3"}, GridPosition{"E3"}}};
+    const pair<int, Shot::Impact> unusualMoves[] = {
+        {22, Shot::Impact::HIT}, {99, Shot::Impact::NONE},
+        {22, Shot::Impact::HIT}, {100, Shot::Impact::NONE},
+        {32, Shot::Impact::HIT}, {0, Shot::Impact::HIT},
+        {42, Shot::Impact::SUNKEN}, {0, Shot::Impact::HIT},
+        {42, Shot::Impact::SUNKEN}, {1, Shot::Impact::SUNKEN}};
+    for (const auto& move : unusualMoves) {
+        unusual.moves.push_back(GameRecord::Move{
+                CellIndex(uint16_t(move.first)), move.second});
+    }
+    string unusualBytes = ReplayWriter::MAGIC;
+    writer.encode(unusual, unusualBytes);
+    ReplayReader unusualReader;
+    GameRecord unusualDecoded;
+    bool sameUnusual = unusualReader.parse(unusualBytes)
+            && unusualReader.readGame(0, unusualDecoded)
+            && unusualDecoded.moves.size() == size(unusualMoves);
+    for (size_t move = 0; move < size(unusualMoves) && sameUnusual; move++) {
+        sameUnusual = unusualDecoded.moves[move].target.value()
+                == unusualMoves[move].first
+                && unusualDecoded.moves[move].impact
+                == unusualMoves[move].second;
+    }
+    assertTrue3(sameUnusual, "Repeated or off-grid shots are not replayed");
+    engine.setRecord(nullptr);
+    ReplayReader reader;
+    GameRecord decoded;
+    bool sameGames = reader.parse(replay) && reader.getGameCount() == 3;
+    for (size_t game = 0; game < recorded.size() && sameGames; game++) {
+        const GameRecord& original = recorded[game];
+        sameGames = reader.readGame(game, decoded)
+                && decoded.rows == 10 && decoded.columns == 10
+                && decoded.moves.size() == original.moves.size();
+        for (size_t move = 0; move < decoded.moves.size() && sameGames;
+                move++) {
+            sameGames = decoded.moves[move].target
+                    == original.moves[move].target
+                    && decoded.moves[move].impact
+                    == original.moves[move].impact;
+        }
+        for (int player = 0; player < 2 && sameGames; player++) {
+            Bitboard originalCells;
+            Bitboard decodedCells;
+            for (const Ship& ship : original.fleets[player]) {
+                originalCells |= ship.occupiedMask(STANDARD_RULES);
+            }
+            for (const Ship& ship : decoded.fleets[player]) {
+                decodedCells |= ship.occupiedMask(STANDARD_RULES);
+            }
+            sameGames = originalCells == decodedCells
+                    && decoded.fleets[player].size() == 10;
+        }
+    }
+    // Every keyframe adds two 100 bit masks and an offset
+    string plain;
+    writer.setKeyframeInterval(0);
+    writer.encode(recorded[2], plain);
+    writer.setKeyframeInterval(ReplayWriter::DEFAULT_KEYFRAME_INTERVAL);
+    string keyframed;
+    writer.encode(recorded[2], keyframed);
+    size_t keyframes = (recorded[2].moves.size() - 1)
+            / ReplayWriter::DEFAULT_KEYFRAME_INTERVAL;
+    assertTrue3(sameGames && !recorded[0].moves.empty()
+                && plain.size() < 40 + recorded[2].moves.size()
+                && keyframes > 0
+                && keyframed.size() <= plain.size() + keyframes * 28,
+                "Replay does not reproduce the recorded games");
+
+    // Seeking without keyframes, with many and with the default interval
+    bool sameStates = true;
+    for (int interval : {0, 5, ReplayWriter::DEFAULT_KEYFRAME_INTERVAL}) {
+        string seekBytes = ReplayWriter::MAGIC;
+        writer.setKeyframeInterval(interval);
+        for (const GameRecord& game : recorded) {
+            writer.encode(game, seekBytes);
+        }
+        ReplayReader seekReader;
+        sameStates = sameStates && seekReader.parse(seekBytes);
+        for (size_t game = 0; game < recorded.size() && sameStates; game++) {
+            ReplayState expected;
+            ReplayState state;
+            const vector<GameRecord::Move>& moves = recorded[game].moves;
+            for (size_t move = 0; move <= moves.size() && sameStates;
+                    move++) {
+                sameStates = seekReader.stateAt(game,
+                        static_cast<int>(move), state)
+                        && state.move == static_cast<int>(move)
+                        && state.shots == expected.shots;
+                if (move < moves.size()
+                        && moves[move].target.value() < 100) {
+                    expected.shots[move & 1] |= Bitboard::cell(
+                            moves[move].target);
+                }
+            }
+            sameStates = sameStates
+                    && (state.hits[0] | state.hits[1]).any()
+                    && !seekReader.stateAt(game,
+                            static_cast<int>(moves.size()) + 1, state)
+                    && seekReader.readGame(game, decoded)
+                    && decoded.moves.size() == moves.size();
+        }
+    }
+    writer.setKeyframeInterval(ReplayWriter::DEFAULT_KEYFRAME_INTERVAL);
+    assertTrue3(sameStates, "Seeking a move does not give its shots");
+    assertTrue3(!reader.parse(replay.substr(0, replay.size() - 1))
+                && reader.getGameCount() == 2 && !reader.parse("BSR2"),
+                "Damaged replay data is not detected");
+
+    const string replayPath = "part4tests.bsr";
+    remove(replayPath.c_str());
+    bool written = writer.open(replayPath) && writer.write(recorded[0]);
+    writer.close();
+    written = written && writer.open(replayPath)
+            && writer.write(recorded[1]);
+    writer.close();
+    assertTrue3(written && reader.load(replayPath)
+                && reader.getGameCount() == 2
+                && reader.readGame(1, decoded)
+                && decoded.moves.size() == recorded[1].moves.size(),
+                "Replay file does not keep appended games");
+    reader = ReplayReader{};
+    remove(replayPath.c_str());
+
+    // Testing the Zobrist hashes of the grids
+    cout << "Zobrist hashes: getHash() Testing" << endl << endl;
+    OpponentGrid inOrder;
+    OpponentGrid reversed;
+    const pair<const char*, Shot::Impact> reports[] = {
+        {"C3", Shot::Impact::NONE}, {"E5", Shot::Impact::HIT},
+        {"H8", Shot::Impact::NONE}, {"E6", Shot::Impact::HIT}};
+    for (const auto& report : reports) {
+        inOrder.shotResult(Shot{GridPosition{report.first}}, report.second);
+    }
+    for (size_t index = size(reports); index-- > 0;) {
+        reversed.shotResult(Shot{GridPosition{reports[index].first}},
+                reports[index].second);
+    }
+    uint64_t beforeSinking = inOrder.getHash();
+    assertTrue3(OpponentGrid{}.getHash() == 0 && beforeSinking != 0
+                && beforeSinking == reversed.getHash(),
+                "Equal opponent states have different hashes");
+    inOrder.shotResult(Shot{GridPosition{"E7"}}, Shot::Impact::SUNKEN);
+    reversed.shotResult(Shot{GridPosition{"E7"}}, Shot::Impact::HIT);
+    assertTrue3(inOrder.getHash() != reversed.getHash()
+                && inOrder.getHash() != beforeSinking,
+                "Sinking a ship does not change the hash");
+    assertTrue3(inOrder.undo() && inOrder.getHash() == beforeSinking
+                && inOrder.redo() && reversed.undo() && reversed.redo(),
+                "Undo does not restore the hash");
+    Board checkpointed{STANDARD_RULES};
+    checkpointed.getOpponentGrid() = inOrder;
+    checkpointed.getOwnGrid().placeShip(Ship{GridPosition{"B2"},
+                                             GridPosition{"B4"}});
+    checkpointed.getOwnGrid().takeBlow(Shot{GridPosition{"B3"}});
+    Board restoredBoard = BoardCheckpoint{checkpointed}.toBoard();
+    assertTrue3(restoredBoard.getOpponentGrid().getHash() == inOrder.getHash()
+                && restoredBoard.getOwnGrid().getHash()
+                       == checkpointed.getOwnGrid().getHash(),
+                "Restored grids have different hashes");
+
+    OwnGrid shotFirst;
+    OwnGrid placedFirst;
+    Ship hashedShip{GridPosition{"D4"}, GridPosition{"D6"}};
+    shotFirst.takeBlow(Shot{GridPosition{"D5"}});
+    shotFirst.takeBlow(Shot{GridPosition{"A1"}});
+    shotFirst.placeShip(hashedShip);
+    placedFirst.placeShip(hashedShip);
+    placedFirst.takeBlow(Shot{GridPosition{"A1"}});
+    uint64_t oneShot = placedFirst.getHash();
+    placedFirst.takeBlow(Shot{GridPosition{"D5"}});
+    placedFirst.takeBlow(Shot{GridPosition{"D5"}});
+    assertTrue3(shotFirst.getHash() == placedFirst.getHash()
+                && placedFirst.undo() && placedFirst.undo()
+                && placedFirst.getHash() == oneShot,
+                "Equal own states have different hashes");
+    placedFirst.reset();
+    assertTrue3(placedFirst.getHash() == 0 && oneShot != 0,
+                "Reset does not clear the hash");
+
+    // Testing the shared transposition table
+    cout << "Class TranspositionTable: find() and store() Testing"
+         << endl << endl;
+    TranspositionTable<double> evaluations{1000};
+    double evaluation = 0;
+    assertTrue3(evaluations.size() == 1024 && !evaluations.find(0, evaluation),
+                "Empty table finds a value");
+    evaluations.store(0, 1.5);
+    evaluations.store(1024 + 7, 2.5);
+    evaluations.store(7, 3.5);
+    assertTrue3(evaluations.find(0, evaluation) && evaluation == 1.5
+                && evaluations.find(7, evaluation) && evaluation == 3.5
+                && !evaluations.find(1024 + 7, evaluation),
+                "Stored values are not found by their hash");
+    evaluations.clear();
+    assertTrue3(!evaluations.find(0, evaluation), "Clear keeps values");
+
+    // Readers must never see a value that mixes two writes
+    using Record = array<uint64_t, 8>;
+    TranspositionTable<Record> shared{16};
+    atomic<long> torn{0};
+    atomic<long> found{0};
+    ThreadPool tablePool{4};
+    tablePool.run(64, [&](size_t task, unsigned) {
+        Random rng{task};
+        for (int step = 0; step < 20000; step++) {
+            uint64_t key = rng.below(64);
+            Record record;
+            if (step % 2 == 0) {
+                record.fill(key * 1000 + task);
+                shared.store(key, record);
+            } else if (shared.find(key, record)) {
+                found++;
+                if (record[0] / 1000 != key || count(record.begin(),
+                        record.end(), record[0]) != 8) {
+                    torn++;
+                }
+            }
+        }
+    });
+    assertTrue3(torn == 0 && found > 0,
+                "Concurrent readers see torn or foreign values");
+
+    HeatMap uncached;
+    HeatMap cached;
+    HeatMap::Cache heatCache{64};
+    uncached.compute(inOrder);
+    cached.compute(inOrder, heatCache);
+    HeatMap::Counts firstCounts = cached.getCounts();
+    cached.compute(reversed);
+    cached.compute(inOrder, heatCache);
+    assertTrue3(cached.getCounts() == uncached.getCounts()
+                && firstCounts == uncached.getCounts()
+                && cached.bestTarget() == uncached.bestTarget()
+                && cached.getLengthCounts(2) == HeatMap::Counts{},
+                "Cached heat map differs from the computed one");
+
+    // Testing the endgame solver: one ship of length 2 on a 1 x 4 strip
+    cout << "Class EndgameSolver: solve() Testing" << endl << endl;
+    RuleSet stripRules{1, 4, RuleSet::Quota{0, 0, 1}, true};
+    EndgameSolver stripSolver{stripRules, 64};
+    OpponentGrid strip{stripRules};
+    EndgameSolution stripSolution = stripSolver.solve(strip);
+    assertTrue3(stripSolution.status == EndgameSolution::SOLVED
+                && stripSolution.layouts == 3
+                && stripSolution.uncertainCells == 4
+                && abs(stripSolution.expectedShots - 8.0 / 3) < 1e-9
+                && (stripSolution.target.value() == 1
+                    || stripSolution.target.value() == 2),
+                "Endgame solver misses the middle of the strip");
+    strip.shotResult(CellIndex{1}, Shot::Impact::HIT);
+    stripSolution = stripSolver.solve(strip);
+    assertTrue3(stripSolution.status == EndgameSolution::SOLVED
+                && abs(stripSolution.expectedShots - 1.5) < 1e-9
+                && stripSolution.target.value() != 3,
+                "Endgame solver does not shoot next to the hit");
+    strip.shotResult(CellIndex{2}, Shot::Impact::SUNKEN);
+    stripSolution = stripSolver.solve(strip);
+    assertTrue3(stripSolution.status == EndgameSolution::SOLVED
+                && stripSolution.expectedShots == 0
+                && stripSolution.target.value() >= stripRules.getCells(),
+                "Endgame solver shoots after the fleet is sunk");
+
+    // A late position of a standard game
+    Random endgameRandom{17};
+    HeatMapStrategy endgameHeat{endgameRandom};
+    FleetGenerator endgameFleets;
+    OwnGrid endgameOwn{STANDARD_RULES};
+    OpponentGrid endgame{STANDARD_RULES};
+    EndgameSolver solver;
+    endgameFleets.fill(endgameOwn, endgameRandom);
+    while (solver.uncertainty(endgame) > solver.getThreshold()) {
+        CellIndex target = endgameHeat.nextShot(endgame);
+        endgame.shotResult(target, endgameOwn.takeBlow(target));
+    }
+    EndgameSolution best = solver.solve(endgame);
+    solver.clearMemo();
+    ThreadPool endgamePool{4};
+    EndgameSolution pooled = solver.solve(endgame, endgamePool);
+    EndgameSolution memoized = solver.solve(endgame);
+    assertTrue3(best.status == EndgameSolution::SOLVED
+                && best.layouts > 1
+                && best.nodes > EndgameSolver::CHECK_NODES
+                && pooled.status == EndgameSolution::SOLVED
+                && pooled.target == best.target
+                && pooled.expectedShots == best.expectedShots
+                && memoized.target == best.target
+                && memoized.nodes <= best.nodes,
+                "Parallel endgame search differs from the serial one");
+    assertTrue3(endgame.getCellState(best.target) == OpponentGrid::UNKNOWN
+                && !endgame.getWaterMask().test(best.target)
+                && best.expectedShots >= 1,
+                "Endgame solver shoots at a known cell");
+
+    solver.setThreshold(0);
+    assertTrue3(solver.solve(endgame).status
+                    == EndgameSolution::TOO_UNCERTAIN,
+                "Endgame solver ignores the uncertainty threshold");
+    solver.setThreshold(EndgameSolver::DEFAULT_THRESHOLD);
+    solver.setMaxLayouts(1);
+    EndgameSolution limited = solver.solve(endgame);
+    assertTrue3(limited.status == EndgameSolution::TOO_MANY_LAYOUTS
+                && limited.layouts == best.layouts,
+                "Endgame solver ignores the layout limit");
+    solver.setMaxLayouts(EndgameSolver::DEFAULT_MAX_LAYOUTS);
+    solver.clearMemo();
+    EndgameBudget tinyBudget;
+    tinyBudget.maxNodes = 1;
+    solver.setBudget(tinyBudget);
+    limited = solver.solve(endgame);
+    assertTrue3(limited.status == EndgameSolution::OUT_OF_BUDGET,
+                "Endgame solver ignores the node budget");
+
+    // The strategy falls back to the heat map and still sinks the fleet
+    solver.setBudget(EndgameBudget{});
+    Random solvingRandom{23};
+    Random randomRandom{29};
+    HeatMapStrategy solving{solvingRandom};
+    RandomStrategy shooter{randomRandom};
+    solving.setEndgameSolver(&solver);
+    MatchEngine endgameEngine;
+    MatchResult solved = endgameEngine.play(solving, shooter);
+    assertTrue3(solved.ending == MatchResult::ALL_SUNK && solved.winner == 0,
+                "Heat map strategy with endgame solver loses");
+}
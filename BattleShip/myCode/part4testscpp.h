@@ -0,0 +1,36 @@
+/**
+ * @file part4testscpp.h
+ * @brief Header file for part4tests.cpp functions.
+ *
+ * @details This file declares the functions used for testing the simulation
+ *          support of the game: random numbers, fleet generation and the
+ *          enumeration of fleet layouts.
+ *
+ * @author Aman Chauhan
+ * @date 17 Oct 2026
+ * @version 1.0
+ * @note Master student at Hochschule Darmstadt
+ * @matriculation_number 1127928
+ */
+
+#ifndef PART4TESTSCPP_H_
+#define PART4TESTSCPP_H_
+
+#include <string>
+
+/**
+ * @brief Helper function to assert if a condition is true and print an error
+ *        message if it fails.
+ *
+ * @param condition The condition to test.
+ * @param failedMessage The message to display if the condition is false.
+ */
+void assertTrue3(bool condition, std::string failedMessage);
+
+/**
+ * @brief Test function for the simulation classes Random, FleetGenerator,
+ *        ThreadPool and FleetEnumerator.
+ */
+void part4tests();
+
+#endif /* PART4TESTSCPP_H_ */